@@ -66,6 +66,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/nodes/CullGroup.h>
 #include <vsg/nodes/CullNode.h>
 #include <vsg/nodes/DepthSorted.h>
+#include <vsg/nodes/DrawBound.h>
 #include <vsg/nodes/Geometry.h>
 #include <vsg/nodes/Group.h>
 #include <vsg/nodes/InstanceDraw.h>
@@ -104,6 +105,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/lighting/DirectionalLight.h>
 #include <vsg/lighting/HardShadows.h>
 #include <vsg/lighting/Light.h>
+#include <vsg/lighting/LightClusters.h>
 #include <vsg/lighting/PercentageCloserSoftShadows.h>
 #include <vsg/lighting/PointLight.h>
 #include <vsg/lighting/ShadowSettings.h>
@@ -193,6 +195,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/threading/OperationQueue.h>
 #include <vsg/threading/OperationThreads.h>
 #include <vsg/threading/atomics.h>
+#include <vsg/threading/parallel_visit.h>
 
 // User Interface abstraction header files
 #include <vsg/ui/ApplicationEvent.h>
@@ -217,6 +220,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/app/CompileManager.h>
 #include <vsg/app/CompileTraversal.h>
 #include <vsg/app/EllipsoidModel.h>
+#include <vsg/app/MultiFrustumCull.h>
 #include <vsg/app/Presentation.h>
 #include <vsg/app/ProjectionMatrix.h>
 #include <vsg/app/RecordAndSubmitTask.h>
@@ -240,6 +244,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/vk/CommandPool.h>
 #include <vsg/vk/Context.h>
 #include <vsg/vk/DescriptorPool.h>
+#include <vsg/vk/DescriptorPoolAccounting.h>
 #include <vsg/vk/DescriptorPools.h>
 #include <vsg/vk/Device.h>
 #include <vsg/vk/DeviceExtensions.h>
@@ -270,6 +275,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/BinaryOutput.h>
 #include <vsg/io/DatabasePager.h>
 #include <vsg/io/FileSystem.h>
+#include <vsg/io/FindFileCache.h>
 #include <vsg/io/Input.h>
 #include <vsg/io/JSONParser.h>
 #include <vsg/io/Logger.h>
@@ -293,16 +299,23 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 // Utility header files
 #include <vsg/utils/Builder.h>
+#include <vsg/utils/BuildSpatialHierarchy.h>
 #include <vsg/utils/CommandLine.h>
 #include <vsg/utils/ComputeBounds.h>
+#include <vsg/utils/ComputeDrawBounds.h>
 #include <vsg/utils/CoordinateSpace.h>
 #include <vsg/utils/FindDynamicObjects.h>
+#include <vsg/utils/GenerateLOD.h>
 #include <vsg/utils/GpuAnnotation.h>
 #include <vsg/utils/GraphicsPipelineConfigurator.h>
+#include <vsg/utils/ImageProcessing.h>
 #include <vsg/utils/Instrumentation.h>
 #include <vsg/utils/Intersector.h>
 #include <vsg/utils/LineSegmentIntersector.h>
 #include <vsg/utils/LoadPagedLOD.h>
+#include <vsg/utils/MergeDrawables.h>
+#include <vsg/utils/MultiLineSegmentIntersector.h>
+#include <vsg/utils/OptimizeVertexCache.h>
 #include <vsg/utils/PolytopeIntersector.h>
 #include <vsg/utils/PrimitiveFunctor.h>
 #include <vsg/utils/Profiler.h>
@@ -13,6 +13,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/animation/AnimationGroup.h>
+#include <vsg/threading/OperationThreads.h>
 #include <vsg/ui/FrameStamp.h>
 #include <vsg/utils/Instrumentation.h>
 
@@ -30,6 +31,14 @@ namespace vsg
 
         ref_ptr<Instrumentation> instrumentation;
 
+        /// optional threads used to update independent animations in parallel, worthwhile when animations are costly such as crowds of skinned characters.
+        /// The calling thread joins in and waits for all updates to complete before run() returns.
+        /// Animations whose samplers write to the same target objects are updated serially, in list order, within a single task.
+        ref_ptr<OperationThreads> operationThreads;
+
+        /// duration in seconds of the most recent run() call
+        double updateDuration = 0.0;
+
         /// assign instrumentation if required
         virtual void assignInstrumentation(ref_ptr<Instrumentation> in_instrumentation);
 
@@ -50,6 +59,9 @@ namespace vsg
 
     protected:
         double _simulationTime = 0.0;
+
+        /// update the animations across the operationThreads, returns false if the animations couldn't be split into independent tasks
+        bool _parallelUpdate();
     };
     VSG_type_name(vsg::AnimationManager);
 
@@ -101,6 +101,10 @@ namespace vsg
             rotations.push_back(QuatKey{time, rotation});
         }
 
+        /// remove keyframes that can be interpolated from their neighbours to within the specified tolerances, rotationTolerance and fieldOfViewTolerance are in radians and degrees respectively.
+        /// The positionTolerance is used for the origins, positions and nearFars keyframes, tracking keyframes are not reduced.
+        void reduce(double positionTolerance, double rotationTolerance, double fieldOfViewTolerance);
+
         void read(Input& input) override;
         void write(Output& output) const override;
     };
@@ -29,9 +29,18 @@ namespace vsg
         std::vector<dmat4> offsetMatrices;
         ref_ptr<Node> subgraph;
 
+        /// update the jointMatrices from the flattened list of transforms and joints.
+        /// Only reassigning subgraph is detected, so after adding/removing transforms or joints within the subgraph flattenSubgraph() must be called explicitly.
         void update(double time) override;
         double maxTime() const override;
 
+        /// build the flattened list of transforms and joints used by update(), called automatically when the subgraph is assigned/replaced.
+        /// Call explicitly after changing the structure of the subgraph.
+        void flattenSubgraph();
+
+        /// append the Transforms and Joints whose matrices are read by update(), flattening the subgraph first if required.
+        void getTransforms(std::vector<const Node*>& transforms);
+
     public:
         ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return JointSampler::create(*this, copyop); }
         int compare(const Object& rhs) const override;
@@ -44,7 +53,20 @@ namespace vsg
         void apply(MatrixTransform& mt) override;
         void apply(Joint& joint) override;
 
-        std::vector<dmat4> _matrixStack;
+    protected:
+        /// transform or joint in the subgraph, stored in traversal order so the parent is always computed before its children
+        struct FlattenedTransform
+        {
+            ref_ptr<Node> node;
+            const dmat4* matrix = nullptr; // MatrixTransform/Joint matrix, nullptr for Transform that requires transform(..) to be called
+            int32_t parent = -1;           // index into _flattenedTransforms, -1 for the subgraph root
+            int32_t jointIndex = -1;       // index into jointMatrices, -1 for non Joint
+        };
+
+        ref_ptr<Node> _flattenedSubgraph; // held so a replacement subgraph can't reuse its address and be mistaken for it
+        std::vector<FlattenedTransform> _flattenedTransforms;
+        std::vector<dmat4> _globalMatrices;
+        std::vector<int32_t> _parentStack;
     };
     VSG_type_name(vsg::JointSampler);
 
@@ -13,6 +13,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/animation/Animation.h>
+#include <vsg/core/Array.h>
 
 namespace vsg
 {
@@ -43,7 +44,35 @@ namespace vsg
     };
     VSG_type_name(vsg::MorphKeyframes);
 
-    /// Animation sampler for morphing geometry, implementation not yet completed.
+    /// MorphTarget holds the sparse per vertex deltas of a single morph target, only the vertices that the target moves are stored.
+    class VSG_DECLSPEC MorphTarget : public Inherit<Object, MorphTarget>
+    {
+    public:
+        MorphTarget();
+        MorphTarget(const MorphTarget& rhs, const CopyOp& copyop = {});
+
+        /// indices of the vertices that the target moves
+        ref_ptr<uintArray> indices;
+
+        /// vertex deltas, one per index
+        ref_ptr<vec3Array> vertexDeltas;
+
+        /// optional normal deltas, one per index
+        ref_ptr<vec3Array> normalDeltas;
+
+        /// assign the sparse indices and deltas from dense per vertex deltas, such as glTF morph targets, skipping vertices whose deltas are all within epsilon of zero.
+        void assignDeltas(const vec3Array* denseVertexDeltas, const vec3Array* denseNormalDeltas = nullptr, float epsilon = 0.0f);
+
+    public:
+        ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return MorphTarget::create(*this, copyop); }
+        int compare(const Object& rhs) const override;
+
+        void read(Input& input) override;
+        void write(Output& output) const override;
+    };
+    VSG_type_name(vsg::MorphTarget);
+
+    /// Animation sampler for morphing geometry, blends the weighted MorphTargets onto the baseVertices/baseNormals and writes the result to the vertices/normals arrays.
     class VSG_DECLSPEC MorphSampler : public Inherit<AnimationSampler, MorphSampler>
     {
     public:
@@ -53,6 +82,20 @@ namespace vsg
         ref_ptr<MorphKeyframes> keyframes;
         ref_ptr<Object> object;
 
+        /// morph targets, indexed by the MorphKey::values
+        std::vector<ref_ptr<MorphTarget>> targets;
+
+        /// unmorphed vertices and normals
+        ref_ptr<vec3Array> baseVertices;
+        ref_ptr<vec3Array> baseNormals;
+
+        /// vertices and normals arrays, typically assigned to the geometry, that the blended results are written to
+        ref_ptr<vec3Array> vertices;
+        ref_ptr<vec3Array> normals;
+
+        /// optional array that the sampled weights are written to, for use when blending morph targets on the GPU
+        ref_ptr<floatArray> weights;
+
         void update(double time) override;
         double maxTime() const override;
 
@@ -62,6 +105,14 @@ namespace vsg
 
         void read(Input& input) override;
         void write(Output& output) const override;
+
+    protected:
+        void blend(vec3Array& destination, const vec3Array& base, bool blendNormals);
+
+        std::vector<float> _weights;
+        std::vector<float> _previousWeights;
+        ref_ptr<const vec3Array> _blendedVertices; // held so a replacement array can't reuse its address and be mistaken for it
+        ref_ptr<const vec3Array> _blendedNormals;
     };
     VSG_type_name(vsg::MorphSampler);
 
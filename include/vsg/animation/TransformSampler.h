@@ -60,11 +60,69 @@ namespace vsg
             scales.push_back(VectorKey{time, scale});
         }
 
+        /// remove keyframes that can be interpolated from their neighbours to within the specified tolerances, rotationTolerance is in radians.
+        void reduce(double positionTolerance, double rotationTolerance, double scaleTolerance);
+
         void read(Input& input) override;
         void write(Output& output) const override;
     };
     VSG_type_name(vsg::TransformKeyframes);
 
+    /// CompressedTransformKeyframes provides a compact alternative to TransformKeyframes that is decoded on the fly by TransformSampler.
+    /// Times are stored as floats, positions and scales are quantized to 16 bits per component across the range of each channel,
+    /// rotations are quantized to 16 bits per component, and keyframes that can be interpolated from their neighbours are removed.
+    class VSG_DECLSPEC CompressedTransformKeyframes : public Inherit<Object, CompressedTransformKeyframes>
+    {
+    public:
+        CompressedTransformKeyframes();
+        CompressedTransformKeyframes(const CompressedTransformKeyframes& rhs, const CopyOp& copyop = {});
+
+        /// compress keyframes so that the decoded keyframes are within the specified tolerances of the originals, or as close as the quantization allows.
+        /// rotationTolerance is in radians.
+        CompressedTransformKeyframes(const TransformKeyframes& keyframes, double positionTolerance, double rotationTolerance, double scaleTolerance);
+
+        /// name of node
+        std::string name;
+
+        /// position = positionOrigin + positions[i] * positionScale
+        ref_ptr<floatArray> positionTimes;
+        ref_ptr<usvec3Array> positions;
+        dvec3 positionOrigin;
+        dvec3 positionScale;
+
+        /// rotation = normalize(rotations[i] / 32767)
+        ref_ptr<floatArray> rotationTimes;
+        ref_ptr<svec4Array> rotations;
+
+        /// scale = scaleOrigin + scales[i] * scaleScale
+        ref_ptr<floatArray> scaleTimes;
+        ref_ptr<usvec3Array> scales;
+        dvec3 scaleOrigin;
+        dvec3 scaleScale;
+
+        dvec3 position(size_t i) const { return positionOrigin + dvec3(positions->at(i)) * positionScale; }
+        dquat rotation(size_t i) const;
+        dvec3 scale(size_t i) const { return scaleOrigin + dvec3(scales->at(i)) * scaleScale; }
+
+        /// sample the channels at the specified time, using cursor to cache the index of the keyframe preceding the time between calls
+        bool samplePosition(double time, dvec3& value, size_t& cursor) const;
+        bool sampleRotation(double time, dquat& value, size_t& cursor) const;
+        bool sampleScale(double time, dvec3& value, size_t& cursor) const;
+
+        double maxTime() const;
+
+        /// decode to full precision TransformKeyframes
+        ref_ptr<TransformKeyframes> decompress() const;
+
+    public:
+        ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return CompressedTransformKeyframes::create(*this, copyop); }
+        int compare(const Object& rhs) const override;
+
+        void read(Input& input) override;
+        void write(Output& output) const override;
+    };
+    VSG_type_name(vsg::CompressedTransformKeyframes);
+
     /// Animation sampler for sampling position, rotation and scale keyframes for setting transforms/joints.
     class VSG_DECLSPEC TransformSampler : public Inherit<AnimationSampler, TransformSampler>
     {
@@ -73,6 +131,10 @@ namespace vsg
         TransformSampler(const TransformSampler& rhs, const CopyOp& copyop = {});
 
         ref_ptr<TransformKeyframes> keyframes;
+
+        /// compressed keyframes, used when keyframes is not assigned
+        ref_ptr<CompressedTransformKeyframes> compressedKeyframes;
+
         ref_ptr<Object> object;
 
         // updated using keyFrames
@@ -98,6 +160,12 @@ namespace vsg
         void apply(Joint& joint) override;
         void apply(LookAt& lookAt) override;
         void apply(Camera& camera) override;
+
+    protected:
+        // indices of the keyframes preceding the most recently sampled time, used to avoid searching the keyframes during playback
+        size_t _positionCursor = 0;
+        size_t _rotationCursor = 0;
+        size_t _scaleCursor = 0;
     };
     VSG_type_name(vsg::TransformSampler);
 
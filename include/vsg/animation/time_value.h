@@ -79,4 +79,138 @@ namespace vsg
         }
     }
 
+    /// sample the keyframe values at the specified time, using cursor to cache the index of the keyframe preceding the time between calls
+    /// so that sampling with monotonically advancing times, as in normal playback, avoids a binary search of the keyframes.
+    /// Returns the same values as sample(time, values, value).
+    template<typename T, typename V>
+    bool sample(double time, const T& values, V& value, size_t& cursor)
+    {
+        size_t size = values.size();
+        if (size == 0) return false;
+
+        if (size == 1 || time <= values.front().time)
+        {
+            cursor = 0;
+            value = values.front().value;
+            return true;
+        }
+
+        if (time > values.back().time)
+        {
+            cursor = size - 1;
+            value = values.back().value;
+            return true;
+        }
+
+        // find the keyframe interval where values[cursor].time < time <= values[cursor+1].time
+        if (cursor < size - 1 && values[cursor].time < time)
+        {
+            // step forward a few keyframes before falling back to a binary search for larger jumps
+            for (int i = 0; values[cursor + 1].time < time; ++i)
+            {
+                if (i == 4)
+                {
+                    using value_type = typename T::value_type;
+                    auto pos_itr = std::lower_bound(values.begin() + cursor + 1, values.end(), time, [](const value_type& elem, double t) -> bool { return elem.time < t; });
+                    cursor = static_cast<size_t>(pos_itr - values.begin()) - 1;
+                    break;
+                }
+                ++cursor;
+            }
+        }
+        else
+        {
+            using value_type = typename T::value_type;
+            auto pos_itr = std::lower_bound(values.begin(), values.end(), time, [](const value_type& elem, double t) -> bool { return elem.time < t; });
+            cursor = static_cast<size_t>(pos_itr - values.begin()) - 1;
+        }
+
+        const auto& before = values[cursor];
+        const auto& after = values[cursor + 1];
+        double delta_time = (after.time - before.time);
+        double r = delta_time != 0.0 ? (time - before.time) / delta_time : 0.5;
+
+        value = mix(before.value, after.value, r);
+
+        return true;
+    }
+
+    /// sample the keyframe values at each of count times, writing the results to the corresponding entries of results.
+    /// A single cursor is carried between the samples, so ascending times are sampled in one forward pass over the keyframes.
+    /// Returns false if there are no keyframes, leaving results unchanged.
+    template<typename T, typename V>
+    bool sample(const double* times, size_t count, const T& values, V* results)
+    {
+        if (values.size() == 0) return false;
+
+        size_t cursor = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            sample(times[i], values, results[i], cursor);
+        }
+        return true;
+    }
+
+    /// difference between keyframe values, used to bound the error when removing keyframes
+    inline double keyframe_error(double lhs, double rhs) { return std::abs(lhs - rhs); }
+    inline double keyframe_error(const dvec2& lhs, const dvec2& rhs) { return length(lhs - rhs); }
+    inline double keyframe_error(const dvec3& lhs, const dvec3& rhs) { return length(lhs - rhs); }
+    inline double keyframe_error(const dvec4& lhs, const dvec4& rhs) { return length(lhs - rhs); }
+
+    /// angle in radians between the rotations
+    inline double keyframe_error(const dquat& lhs, const dquat& rhs) { return 2.0 * std::acos(std::min(1.0, std::abs(dot(lhs, rhs)))); }
+
+    /// return the indices of the keyframes in values to keep so that interpolating between them reproduces each of the reference keyframes to within tolerance.
+    /// values and reference must have the same number of keyframes, values may differ from reference, such as when values are quantized versions of reference.
+    template<typename T>
+    std::vector<size_t> select_keyframes(const std::vector<time_value<T>>& values, const std::vector<time_value<T>>& reference, double tolerance)
+    {
+        // limit how far back each candidate keyframe is checked so constant channels don't have quadratic cost
+        const size_t maxSpan = 1024;
+
+        std::vector<size_t> indices;
+        size_t size = values.size();
+        if (size == 0) return indices;
+
+        indices.push_back(0);
+
+        size_t anchor = 0;
+        for (size_t next = 2; next < size; ++next)
+        {
+            const auto& before = values[anchor];
+            const auto& after = values[next];
+            double delta_time = (after.time - before.time);
+
+            bool withinTolerance = (next - anchor) <= maxSpan;
+            for (size_t i = anchor + 1; i < next && withinTolerance; ++i)
+            {
+                double r = delta_time != 0.0 ? (reference[i].time - before.time) / delta_time : 0.5;
+                withinTolerance = keyframe_error(mix(before.value, after.value, r), reference[i].value) <= tolerance;
+            }
+
+            if (!withinTolerance)
+            {
+                anchor = next - 1;
+                indices.push_back(anchor);
+            }
+        }
+
+        if (size > 1) indices.push_back(size - 1);
+
+        return indices;
+    }
+
+    /// remove the keyframes that can be interpolated from the remaining keyframes to within tolerance
+    template<typename T>
+    void reduce_keyframes(std::vector<time_value<T>>& values, double tolerance)
+    {
+        auto indices = select_keyframes(values, values, tolerance);
+        if (indices.size() == values.size()) return;
+
+        std::vector<time_value<T>> reduced;
+        reduced.reserve(indices.size());
+        for (auto index : indices) reduced.push_back(values[index]);
+        values.swap(reduced);
+    }
+
 } // namespace vsg
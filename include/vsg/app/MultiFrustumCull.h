@@ -0,0 +1,122 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/ConstVisitor.h>
+#include <vsg/core/Mask.h>
+#include <vsg/nodes/Node.h>
+#include <vsg/vk/State.h>
+
+namespace vsg
+{
+
+    /// DrawList node holds a list of leaf nodes, with their model matrix and StateCommand stack, collected by MultiFrustumCull for a single view.
+    /// When traversed by the RecordTraversal the elements are recorded in order, combining the model matrices with the current view matrix.
+    class VSG_DECLSPEC DrawList : public Inherit<Node, DrawList>
+    {
+    public:
+        DrawList();
+
+        struct Element
+        {
+            uint32_t matrixIndex = 0;
+            uint32_t stateCommandIndex = 0;
+            uint32_t stateCommandCount = 0;
+            const Node* child = nullptr;
+        };
+
+        std::vector<dmat4> matrices;
+        std::vector<const StateCommand*> stateCommands;
+        std::vector<Element> elements;
+
+        void clear();
+
+        /// add a leaf node with its model matrix and StateCommand stack, reusing the previous element's matrix and state commands when they match.
+        void add(const dmat4& matrix, const std::vector<const StateCommand*>& stateStack, const Node* node);
+
+        void traverse(RecordTraversal& visitor) const override;
+
+    protected:
+        virtual ~DrawList();
+    };
+    VSG_type_name(vsg::DrawList);
+
+    /// MultiFrustumCull traverses a scene graph once, testing each node's bounding sphere against the view frustum of all views at once,
+    /// passing a bitmask of the views the subgraph is visible in down the traversal and adding the visible leaf nodes to each view's DrawList.
+    /// Used by ViewDependentState to cull all the shadow map views with a single scene graph traversal.
+    class VSG_DECLSPEC MultiFrustumCull : public Inherit<ConstVisitor, MultiFrustumCull>
+    {
+    public:
+        MultiFrustumCull();
+
+        /// maximum number of views supported by the 32 bit view mask
+        static constexpr size_t maxNumViews = 32;
+
+        struct ViewFrustum
+        {
+            dmat4 projectionMatrix;
+            dmat4 viewMatrix;
+            ref_ptr<DrawList> drawList;
+        };
+
+        std::vector<ViewFrustum> views;
+
+        /// projection and view matrices used to select LOD and PagedLOD children, typically those of the main view so all views use the same level of detail.
+        dmat4 lodProjectionMatrix;
+        dmat4 lodViewMatrix;
+
+        Mask traversalMask = MASK_ALL;
+        Mask overrideMask = MASK_OFF;
+
+        /// number of bounding sphere vs frustum tests done by the last cull() call
+        size_t numFrustumTests = 0;
+
+        /// clear the views' DrawLists then traverse the node, adding the leaf nodes visible in each view to its DrawList.
+        void cull(const Node& node);
+
+        void apply(const Node& node) override;
+        void apply(const Group& group) override;
+        void apply(const QuadGroup& quadGroup) override;
+        void apply(const LOD& lod) override;
+        void apply(const PagedLOD& plod) override;
+        void apply(const CullGroup& cullGroup) override;
+        void apply(const CullNode& cullNode) override;
+        void apply(const DepthSorted& depthSorted) override;
+        void apply(const Layer& layer) override;
+        void apply(const Switch& sw) override;
+        void apply(const StateGroup& stateGroup) override;
+        void apply(const Transform& transform) override;
+        void apply(const CoordinateFrame& cf) override;
+
+    protected:
+        /// frusta in the local coordinate frame for each view, with the last entry used for LOD selection
+        using Frusta = std::vector<Frustum>;
+
+        /// return the mask of the currently active views that the sphere intersects
+        uint32_t intersect(const dsphere& bs);
+
+        /// return the distance of the sphere from the LOD view, scaled by the LOD view's projection
+        double lodDistance(const dsphere& bs) const;
+
+        void pushFrusta(const dmat4& matrix);
+        void popFrusta();
+
+        uint32_t _mask = 0;
+        std::vector<dmat4> _matrixStack;
+        std::vector<Frusta> _frustaStack;
+        std::vector<Frustum> _projectedFrusta;
+        std::vector<const StateCommand*> _stateStack;
+    };
+    VSG_type_name(vsg::MultiFrustumCull);
+
+} // namespace vsg
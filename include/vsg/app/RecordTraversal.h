@@ -43,6 +43,8 @@ namespace vsg
     class VertexDraw;
     class VertexIndexDraw;
     class Geometry;
+    class DrawBound;
+    class BufferInfo;
     class Command;
     class Commands;
     class CommandBuffer;
@@ -95,6 +97,10 @@ namespace vsg
 
         ref_ptr<Instrumentation> instrumentation;
 
+        /// number of VertexDraw, VertexIndexDraw and Geometry tested and culled against their enabled DrawBound, reset at the start of each CommandGraph/SecondaryCommandGraph::record()
+        uint32_t numDrawsTested = 0;
+        uint32_t numDrawsCulled = 0;
+
         /// Container for CommandBuffers that have been recorded in current frame
         ref_ptr<RecordedCommandBuffers> recordedCommandBuffers;
 
@@ -176,6 +182,9 @@ namespace vsg
     protected:
         virtual ~RecordTraversal();
 
+        /// return true if the draw is outside the view frustum
+        bool cullDraw(const DrawBound& drawBound, const std::vector<ref_ptr<BufferInfo>>& arrays);
+
         ref_ptr<FrameStamp> _frameStamp;
         ref_ptr<State> _state;
 
@@ -139,6 +139,35 @@ namespace vsg
             return ref_ptr<Array>(new Array(*this, copyop));
         }
 
+        ref_ptr<Data> cloneSharingStorage() const override
+        {
+            if (_storage)
+            {
+                auto offset = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(_data) - reinterpret_cast<uintptr_t>(_storage->dataPointer()));
+                return Array::create(_storage, offset, properties.stride, _size, properties);
+            }
+            return Array::create(ref_ptr<Data>(const_cast<Array*>(this)), 0, properties.stride, _size, properties);
+        }
+
+        bool ensureUniqueStorage() override
+        {
+            if (!_storage || _storage->referenceCount() == 1) return false;
+
+            // keep the shared storage referenced while its values are copied
+            auto storage = _storage;
+            // copy all values including any mipmaps
+            size_t count = size();
+            auto data = _allocate(count);
+            for (size_t i = 0; i < count; ++i) data[i] = *(this->data(i));
+
+            _data = data;
+            _storage = nullptr;
+            properties.stride = sizeof(value_type);
+
+            dirty();
+            return true;
+        }
+
         size_t sizeofObject() const noexcept override { return sizeof(Array); }
         const char* className() const noexcept override { return type_name<Array>(); }
         const std::type_info& type_info() const noexcept override { return typeid(*this); }
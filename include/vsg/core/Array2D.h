@@ -117,6 +117,35 @@ namespace vsg
             return ref_ptr<Array2D>(new Array2D(*this, copyop));
         }
 
+        ref_ptr<Data> cloneSharingStorage() const override
+        {
+            if (_storage)
+            {
+                auto offset = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(_data) - reinterpret_cast<uintptr_t>(_storage->dataPointer()));
+                return Array2D::create(_storage, offset, properties.stride, _width, _height, properties);
+            }
+            return Array2D::create(ref_ptr<Data>(const_cast<Array2D*>(this)), 0, properties.stride, _width, _height, properties);
+        }
+
+        bool ensureUniqueStorage() override
+        {
+            if (!_storage || _storage->referenceCount() == 1) return false;
+
+            // keep the shared storage referenced while its values are copied
+            auto storage = _storage;
+            // copy all values including any mipmaps
+            size_t count = size();
+            auto data = _allocate(count);
+            for (size_t i = 0; i < count; ++i) data[i] = *(this->data(i));
+
+            _data = data;
+            _storage = nullptr;
+            properties.stride = sizeof(value_type);
+
+            dirty();
+            return true;
+        }
+
         size_t sizeofObject() const noexcept override { return sizeof(Array2D); }
         const char* className() const noexcept override { return type_name<Array2D>(); }
         const std::type_info& type_info() const noexcept override { return typeid(*this); }
@@ -193,6 +193,14 @@ namespace vsg
         MipmapOffsets computeMipmapOffsets() const;
         static size_t computeValueCountIncludingMipmaps(size_t w, size_t h, size_t d, uint32_t maxNumMipmaps);
 
+        /// return a clone that references this Data's storage rather than copying it, used to implement copy on write cloning of dynamic data.
+        /// Data types that can't share storage return a full copy.
+        virtual ref_ptr<Data> cloneSharingStorage() const { return clone().cast<Data>(); }
+
+        /// copy any storage that is shared with other Data objects so that subsequent modifications only affect this Data, return true if a copy was made.
+        /// Call before modifying Data that may have been created by cloneSharingStorage().
+        virtual bool ensureUniqueStorage() { return false; }
+
         /// increment the ModifiedCount to signify the data has been modified
         void dirty() { ++_modifiedCount; }
 
@@ -104,6 +104,30 @@ namespace vsg
         /// for systems with smaller GPU memory limits you may need to reduce the targetMaxNumPagedLODWithHighResSubgraphs to keep memory usage within available limits.
         uint32_t targetMaxNumPagedLODWithHighResSubgraphs = 1500;
 
+        /// byte budgets for the estimated CPU and device memory used by the loaded high resolution subgraphs, a value of 0 disables the budget.
+        /// When a budget is exceeded the least recently used inactive high resolution subgraphs are released until usage is back within budget.
+        uint64_t targetMaxDataSize = 0;
+        uint64_t targetMaxDeviceMemorySize = 0;
+
+        /// estimated CPU and device memory used by the merged high resolution subgraphs, updated by updateSceneGraph()
+        uint64_t dataSize = 0;
+        uint64_t deviceMemorySize = 0;
+
+        /// per frame budgets for merging loaded subgraphs into the scene graph, a value of 0 disables the budget.
+        /// Subgraphs are merged in PagedLOD priority order, with at least one merged each frame, and the remainder carried over to the next frame.
+        double maxMergeTimePerFrame = 0.0; // seconds
+        uint64_t maxMergeBytesPerFrame = 0; // estimated CPU + device memory of the merged subgraphs
+
+        /// statistics of the merges done by the most recent updateSceneGraph() call, latency is the time in seconds from request to merge
+        struct MergeStats
+        {
+            uint32_t numMerged = 0;
+            uint32_t numDeferred = 0;
+            double averageLatency = 0.0;
+            double maximumLatency = 0.0;
+        };
+        MergeStats mergeStats;
+
         std::mutex pendingPagedLODMutex;
 
         ref_ptr<PagedLODContainer> pagedLODContainer;
@@ -126,6 +150,7 @@ namespace vsg
 
         ref_ptr<DatabaseQueue> _requestQueue;
         ref_ptr<DatabaseQueue> _toMergeQueue;
+        DatabaseQueue::Nodes _deferredMerges;
         ref_ptr<DeleteQueue> _deleteQueue;
     };
     VSG_type_name(vsg::DatabasePager);
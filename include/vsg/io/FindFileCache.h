@@ -0,0 +1,66 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Inherit.h>
+#include <vsg/io/Path.h>
+
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace vsg
+{
+
+    /// FindFileCache caches the file existence checks made by vsg::findFile(filename, options) when assigned to Options::findFileCache,
+    /// avoiding repeated file system queries when the same files are searched for repeatedly, such as by DatabasePager threads reading paged databases.
+    /// Cached results are not updated when files are added or removed, call clear() to invalidate them.
+    class VSG_DECLSPEC FindFileCache : public Inherit<Object, FindFileCache>
+    {
+    public:
+        FindFileCache();
+
+        /// when true the contents of each directory searched are read once using getDirectoryContents() and used to answer all checks for files in that directory.
+        /// File names are matched case sensitively.
+        bool indexDirectories = false;
+
+        /// return true if the file exists, using cached results when available
+        bool fileExists(const Path& path);
+
+        /// remove all cached results
+        void clear();
+
+        /// remove the cached results for files in the specified directory
+        void clear(const Path& directory);
+
+        struct Stats
+        {
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+            uint64_t directoriesIndexed = 0;
+        };
+
+        /// return the cache hit/miss counts
+        Stats getStats() const;
+
+    protected:
+        virtual ~FindFileCache();
+
+        mutable std::mutex _mutex;
+        std::unordered_map<Path::string_type, bool> _fileExists;
+        std::unordered_map<Path::string_type, std::unordered_set<Path::string_type>> _directoryContents;
+        Stats _stats;
+    };
+    VSG_type_name(vsg::FindFileCache);
+
+} // namespace vsg
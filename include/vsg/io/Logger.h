@@ -15,6 +15,9 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/core/Inherit.h>
 #include <vsg/io/stream.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <string_view>
 #include <thread>
@@ -60,7 +63,7 @@ namespace vsg
         {
             if (level > LOGGER_DEBUG) return;
 
-            std::scoped_lock<std::mutex> lock(_mutex);
+            auto lock = _lockImplementation();
             debug_implementation(str);
         }
 
@@ -69,12 +72,12 @@ namespace vsg
         {
             if (level > LOGGER_DEBUG) return;
 
-            std::scoped_lock<std::mutex> lock(_mutex);
-            _stream.str({});
-            _stream.clear();
-            (_stream << ... << args);
+            auto& stream = _threadStream();
+            (stream << ... << args);
 
-            debug_implementation(_stream.str());
+            auto lock = _lockImplementation();
+
+            debug_implementation(stream.str());
         }
 
         inline void info(char* message) { info(std::string_view(message)); }
@@ -86,7 +89,7 @@ namespace vsg
         {
             if (level > LOGGER_INFO) return;
 
-            std::scoped_lock<std::mutex> lock(_mutex);
+            auto lock = _lockImplementation();
             info_implementation(str);
         }
 
@@ -95,12 +98,12 @@ namespace vsg
         {
             if (level > LOGGER_INFO) return;
 
-            std::scoped_lock<std::mutex> lock(_mutex);
-            _stream.str({});
-            _stream.clear();
-            (_stream << ... << args);
+            auto& stream = _threadStream();
+            (stream << ... << args);
+
+            auto lock = _lockImplementation();
 
-            info_implementation(_stream.str());
+            info_implementation(stream.str());
         }
 
         inline void warn(char* message) { warn(std::string_view(message)); }
@@ -112,7 +115,7 @@ namespace vsg
         {
             if (level > LOGGER_WARN) return;
 
-            std::scoped_lock<std::mutex> lock(_mutex);
+            auto lock = _lockImplementation();
             warn_implementation(str);
         }
 
@@ -121,12 +124,12 @@ namespace vsg
         {
             if (level > LOGGER_WARN) return;
 
-            std::scoped_lock<std::mutex> lock(_mutex);
-            _stream.str({});
-            _stream.clear();
-            (_stream << ... << args);
+            auto& stream = _threadStream();
+            (stream << ... << args);
+
+            auto lock = _lockImplementation();
 
-            warn_implementation(_stream.str());
+            warn_implementation(stream.str());
         }
 
         inline void error(char* message) { error(std::string_view(message)); }
@@ -138,7 +141,7 @@ namespace vsg
         {
             if (level > LOGGER_ERROR) return;
 
-            std::scoped_lock<std::mutex> lock(_mutex);
+            auto lock = _lockImplementation();
             error_implementation(str);
         }
 
@@ -147,12 +150,12 @@ namespace vsg
         {
             if (level > LOGGER_ERROR) return;
 
-            std::scoped_lock<std::mutex> lock(_mutex);
-            _stream.str({});
-            _stream.clear();
-            (_stream << ... << args);
+            auto& stream = _threadStream();
+            (stream << ... << args);
 
-            error_implementation(_stream.str());
+            auto lock = _lockImplementation();
+
+            error_implementation(stream.str());
         }
 
         inline void fatal(char* message) { fatal(std::string_view(message)); }
@@ -164,7 +167,7 @@ namespace vsg
         {
             if (level > LOGGER_FATAL) return;
 
-            std::scoped_lock<std::mutex> lock(_mutex);
+            auto lock = _lockImplementation();
             fatal_implementation(str);
         }
 
@@ -173,12 +176,12 @@ namespace vsg
         {
             if (level > LOGGER_FATAL) return;
 
-            std::scoped_lock<std::mutex> lock(_mutex);
-            _stream.str({});
-            _stream.clear();
-            (_stream << ... << args);
+            auto& stream = _threadStream();
+            (stream << ... << args);
+
+            auto lock = _lockImplementation();
 
-            fatal_implementation(_stream.str());
+            fatal_implementation(stream.str());
         }
 
         using PrintToStreamFunction = std::function<void(std::ostream&)>;
@@ -212,18 +215,18 @@ namespace vsg
         {
             if (level > msg_level) return;
 
-            std::scoped_lock<std::mutex> lock(_mutex);
-            _stream.str({});
-            _stream.clear();
-            (_stream << ... << args);
+            auto& stream = _threadStream();
+            (stream << ... << args);
+
+            auto lock = _lockImplementation();
 
             switch (msg_level)
             {
-            case (LOGGER_DEBUG): debug_implementation(_stream.str()); break;
-            case (LOGGER_INFO): info_implementation(_stream.str()); break;
-            case (LOGGER_WARN): warn_implementation(_stream.str()); break;
-            case (LOGGER_ERROR): error_implementation(_stream.str()); break;
-            case (LOGGER_FATAL): fatal_implementation(_stream.str()); break;
+            case (LOGGER_DEBUG): debug_implementation(stream.str()); break;
+            case (LOGGER_INFO): info_implementation(stream.str()); break;
+            case (LOGGER_WARN): warn_implementation(stream.str()); break;
+            case (LOGGER_ERROR): error_implementation(stream.str()); break;
+            case (LOGGER_FATAL): fatal_implementation(stream.str()); break;
             default: break;
             }
         }
@@ -237,6 +240,17 @@ namespace vsg
         std::mutex _mutex;
         std::ostringstream _stream;
 
+        /// when true calls to the *_implementation() methods are serialized using _mutex, thread safe subclasses can set this to false to avoid the lock.
+        bool _serializeImplementation = true;
+
+        std::unique_lock<std::mutex> _lockImplementation()
+        {
+            return _serializeImplementation ? std::unique_lock<std::mutex>(_mutex) : std::unique_lock<std::mutex>();
+        }
+
+        /// cleared stream local to the calling thread, used to format messages without holding _mutex
+        static std::ostringstream& _threadStream();
+
         std::unique_ptr<std::streambuf> _override_cout;
         std::unique_ptr<std::streambuf> _override_cerr;
         std::streambuf* _original_cout = nullptr;
@@ -364,6 +378,9 @@ namespace vsg
         /// assign prefix for std::thread::id. The id can be obtained from std::thread::get_id() i.e. thread->get_id() or this_thread::get_id().
         void setThreadPrefix(std::thread::id id, const std::string& str);
 
+        /// log message prefixed for the specified thread rather than the calling thread, used by AsyncLogger to label messages with the thread that logged them.
+        void logFromThread(std::thread::id id, Level msg_level, const std::string_view& message);
+
         std::string debugPrefix = "debug: ";
         std::string infoPrefix = "info: ";
         std::string warnPrefix = "Warning: ";
@@ -374,6 +391,7 @@ namespace vsg
 
     protected:
         void print_id(FILE* out, std::thread::id id);
+        void print(FILE* out, std::thread::id id, const std::string& prefix, const std::string_view& message);
 
         void debug_implementation(const std::string_view& message) override;
         void info_implementation(const std::string_view& message) override;
@@ -402,6 +420,62 @@ namespace vsg
     };
     VSG_type_name(vsg::NullLogger);
 
+    /// Logger that formats messages on the calling thread and passes them through a bounded lock-free queue to a background thread that writes them to a destination Logger,
+    /// so that threads logging concurrently don't serialize on writing output. When the queue is full messages are dropped and counted.
+    /// Fatal messages are written on the calling thread once the queued messages have been flushed.
+    /// When the destination is a ThreadLogger messages are prefixed with the thread that logged them rather than the background thread.
+    /// To use the AsyncLogger use:
+    ///     vsg::Logger::instance() = AsyncLogger::create(vsg::Logger::instance());
+    class VSG_DECLSPEC AsyncLogger : public Inherit<Logger, AsyncLogger>
+    {
+    public:
+        explicit AsyncLogger(ref_ptr<Logger> in_logger = {}, size_t queueSize = 4096);
+
+        /// logger that messages are written to by the background thread, defaults to StdLogger.
+        Logger* getLogger() { return _logger.get(); }
+        const Logger* getLogger() const { return _logger.get(); }
+
+        /// number of messages dropped because the queue was full
+        uint64_t numDroppedMessages() const { return _numDroppedMessages.load(); }
+
+        /// wait till the messages queued so far have been written, then flush the destination logger
+        void flush() override;
+
+    protected:
+        virtual ~AsyncLogger();
+
+        bool push(Level msg_level, const std::string_view& message);
+        void run();
+
+        void debug_implementation(const std::string_view& message) override;
+        void info_implementation(const std::string_view& message) override;
+        void warn_implementation(const std::string_view& message) override;
+        void error_implementation(const std::string_view& message) override;
+        void fatal_implementation(const std::string_view& message) override;
+
+        struct Message
+        {
+            std::atomic<size_t> sequence;
+            Level level = LOGGER_INFO;
+            std::thread::id threadId;
+            std::string text;
+        };
+
+        ref_ptr<Logger> _logger;
+        std::unique_ptr<Message[]> _messages;
+        size_t _mask = 0;
+        std::atomic<size_t> _enqueuePosition{0};
+        std::atomic<size_t> _dequeuePosition{0};
+        std::atomic<uint64_t> _numDroppedMessages{0};
+
+        std::atomic<bool> _running{true};
+        std::atomic<bool> _writerWaiting{false};
+        std::mutex _writerMutex;
+        std::condition_variable _writerCondition;
+        std::thread _writerThread;
+    };
+    VSG_type_name(vsg::AsyncLogger);
+
     /// Helper class for recording a set of indented log output
     struct LogOutput
     {
@@ -29,6 +29,7 @@ namespace vsg
     class ShaderSet;
     class FindDynamicObjects;
     class PropagateDynamicObjects;
+    class FindFileCache;
 
     using ReaderWriters = std::vector<ref_ptr<ReaderWriter>>;
 
@@ -71,6 +72,9 @@ namespace vsg
         using FindFileCallback = std::function<Path(const Path& filename, const Options* options)>;
         FindFileCallback findFileCallback;
 
+        /// optional cache of the file existence checks made by vsg::findFile(filename, options), shared with copies of this Options object.
+        ref_ptr<FindFileCache> findFileCache;
+
         Path fileCache;
 
         Path extensionHint;
@@ -103,6 +107,14 @@ namespace vsg
         /// mechanism for propagating dynamic objects classification up parental chain so that cloning is done on all dynamic objects to avoid sharing of dynamic parts.
         ref_ptr<PropagateDynamicObjects> propagateDynamicObjects;
 
+        /// when cloning the dynamic objects of a shared loaded object, share the storage of dynamic arrays between the clones rather than copying it.
+        /// Code modifying such arrays must call Data::ensureUniqueStorage() before writing to them so that the write isn't seen by the other clones.
+        bool copyOnWriteDynamicData = false;
+
+        /// enable and compute the DrawBound of the VertexDraw, VertexIndexDraw and Geometry leaves in loaded subgraphs, using ComputeDrawBounds, so that RecordTraversal can cull them.
+        /// Should not be used with models whose vertex shaders displace vertices such as skinned meshes.
+        bool computeDrawBounds = false;
+
         enum InstanceNodeHint
         {
             INSTANCE_NONE = 0,
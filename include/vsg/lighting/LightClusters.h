@@ -0,0 +1,87 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Array.h>
+#include <vsg/core/Inherit.h>
+#include <vsg/maths/mat4.h>
+#include <vsg/maths/sphere.h>
+
+namespace vsg
+{
+
+    /// LightClusters assigns positional lights to a 3D grid of view space clusters (froxels), tiled in x and y across the viewport and sliced exponentially in depth,
+    /// so that fragment shaders only need to loop over the lights that can affect their cluster rather than all the lights in the view.
+    /// Assign to ViewDependentState::lightClusters before ViewDependentState::init() to enable, the cluster data is then provided to shaders using the VSG_CLUSTERED_LIGHTS define
+    /// via the "lightClusterParameters", "lightClusterGrid" and "lightClusterIndices" descriptors.
+    class VSG_DECLSPEC LightClusters : public Inherit<Object, LightClusters>
+    {
+    public:
+        explicit LightClusters(const uivec3& in_dimensions = {16, 9, 24}, uint32_t in_maxLightIndices = 16384);
+
+        /// number of clusters in x, y and depth
+        const uivec3 dimensions;
+
+        /// maximum number of light indices across all clusters, lights that don't fit are dropped from the remaining clusters
+        const uint32_t maxLightIndices;
+
+        /// the far plane used for the depth slices is clamped to maxDistance to avoid infinite or very distant far planes wasting the depth slices
+        double maxDistance = 1e4;
+
+        /// [0] = (near, far, depth slice scale, depth slice bias), [1] = (dimensions.x, dimensions.y, dimensions.z, number of light indices assigned)
+        ref_ptr<vec4Array> parameters;
+
+        /// (offset, count) into indices for each cluster, indexed by x + dimensions.x * (y + dimensions.y * z)
+        ref_ptr<uivec2Array> grid;
+
+        /// light indices for each cluster, indexing the lights in the order they were added
+        ref_ptr<uintArray> indices;
+
+        /// clear the lights ready to add a new frame's lights
+        void clear();
+
+        /// add a light's eye space bounding sphere
+        void add(const dsphere& eyeSpaceBound);
+
+        /// assign the lights to clusters using the projection matrix and near/far distances of the view.
+        void assign(const dmat4& projectionMatrix, double nearDistance, double farDistance);
+
+        /// return the depth slice for an eye space distance
+        uint32_t slice(double distance) const;
+
+        /// return the index of the cluster
+        uint32_t clusterIndex(uint32_t x, uint32_t y, uint32_t z) const { return x + dimensions.x * (y + dimensions.y * z); }
+
+        /// lights added since the last clear()
+        std::vector<dsphere> lights;
+
+    protected:
+        virtual ~LightClusters();
+
+        double _near = 1.0;
+        double _far = 1e4;
+        double _sliceScale = 1.0;
+        double _sliceBias = 0.0;
+
+        struct Range
+        {
+            uivec3 min;
+            uivec3 max;
+        };
+
+        std::vector<Range> _lightRanges;
+        std::vector<uint32_t> _counts;
+    };
+    VSG_type_name(vsg::LightClusters);
+
+} // namespace vsg
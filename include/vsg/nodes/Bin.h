@@ -27,7 +27,9 @@ namespace vsg
         {
             NO_SORT,
             ASCENDING,
-            DESCENDING
+            DESCENDING,
+            STATE_SORT,          // group elements with the same StateCommand stack, ordered pipeline first then descriptor sets, to minimize rebinds when recording
+            STATE_SORT_ASCENDING // group elements as per STATE_SORT, then sort front to back within each group of matching state
         };
 
         Bin();
@@ -41,6 +43,12 @@ namespace vsg
 
         void add(State* state, double value, const Node* node);
 
+        /// number of StateCommand changes between consecutive elements when last traversed, recorded in insertion order and in the order recorded,
+        /// only computed for STATE_SORT and STATE_SORT_ASCENDING when the RecordTraversal has instrumentation assigned.
+        /// The difference between the two is the number of pipeline and descriptor set rebinds saved by state sorting.
+        mutable uint32_t numStateChangesUnsorted = 0;
+        mutable uint32_t numStateChangesSorted = 0;
+
     public:
         ref_ptr<Object> clone(const CopyOp& copyop = {}) const override { return Bin::create(*this, copyop); }
         int compare(const Object& rhs) const override;
@@ -66,6 +74,12 @@ namespace vsg
 
         std::vector<Element> _elements;
 
+        /// return -1, 0 or 1 for lhs state commands less than, equal to or greater than rhs, comparing by slot then StateCommand so lower slots such as the pipeline take precedence
+        int compareStateCommands(const Element& lhs, const Element& rhs) const;
+
+        /// count the StateCommand changes between consecutive elements in _binElements
+        uint32_t countStateChanges() const;
+
         using KeyIndex = std::pair<float, uint32_t>;
         mutable std::vector<KeyIndex> _binElements;
     };
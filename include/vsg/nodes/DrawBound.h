@@ -0,0 +1,56 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/maths/sphere.h>
+#include <vsg/state/BufferInfo.h>
+
+#include <atomic>
+#include <mutex>
+
+namespace vsg
+{
+
+    /// DrawBound holds a lazily computed bounding sphere of a drawable's vertex array, recomputed when the array's ModifiedCount changes.
+    /// When enabled, RecordTraversal culls VertexDraw, VertexIndexDraw and Geometry leaves against their DrawBound without the need for a decorating CullNode.
+    /// Only enable for non instanced drawables whose vertex shader doesn't displace the vertices, i.e. no billboarding, skinning or displacement mapping.
+    class VSG_DECLSPEC DrawBound
+    {
+    public:
+        DrawBound() = default;
+        DrawBound(const DrawBound& rhs);
+        DrawBound& operator=(const DrawBound& rhs);
+
+        /// enable culling of the drawable against the bound of its vertices
+        bool enabled = false;
+
+        /// return the bound of the first array in the list of arrays, assumed to be the vertex positions, recomputing it if the array has changed since the last call.
+        /// Returns an invalid sphere when the array type isn't supported, vec3Array, vec4Array and dvec3Array are supported.
+        dsphere get(const BufferInfoList& arrays) const;
+
+        /// compute the bound of a vertex array
+        static dsphere compute(const Data* vertices);
+
+    protected:
+        /// serializes recomputing the bound, _vertices keeps the array referenced so its address can't be reused by another array
+        mutable std::mutex _mutex;
+        mutable ref_ptr<const Data> _vertices;
+
+        /// seqlock published copy of the cached bound so get() reads it without locking, _sequence is odd while an update is in progress
+        mutable std::atomic<uint64_t> _sequence{0};
+        mutable std::atomic<const Data*> _cachedVertices{nullptr};
+        mutable std::atomic<uint32_t> _cachedModifiedCount{0};
+        mutable std::atomic<double> _cachedBound[4] = {};
+    };
+
+} // namespace vsg
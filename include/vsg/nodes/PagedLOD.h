@@ -18,6 +18,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/vk/Semaphore.h>
 
 #include <array>
+#include <chrono>
 
 namespace vsg
 {
@@ -105,6 +106,13 @@ namespace vsg
         mutable uint32_t index = 0;
 
         ref_ptr<Node> pending;
+
+        /// time the DatabasePager accepted the request to load the high resolution child, used to measure merge latency
+        std::chrono::steady_clock::time_point requestTime;
+
+        /// estimated CPU and device memory used by the loaded high resolution child, assigned by the DatabasePager
+        uint64_t highResDataSize = 0;
+        uint64_t highResDeviceMemorySize = 0;
     };
     VSG_type_name(vsg::PagedLOD);
 
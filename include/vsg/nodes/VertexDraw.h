@@ -13,6 +13,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/commands/Command.h>
+#include <vsg/nodes/DrawBound.h>
 #include <vsg/nodes/Node.h>
 #include <vsg/state/BufferInfo.h>
 
@@ -37,6 +38,9 @@ namespace vsg
         uint32_t firstBinding = 0;
         BufferInfoList arrays;
 
+        /// optional bound of the vertex array used by RecordTraversal to cull the draw
+        DrawBound drawBound;
+
         void assignArrays(const DataList& in_arrays);
 
     public:
@@ -13,6 +13,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/commands/Command.h>
+#include <vsg/nodes/DrawBound.h>
 #include <vsg/nodes/Node.h>
 #include <vsg/state/BufferInfo.h>
 
@@ -39,6 +40,9 @@ namespace vsg
         BufferInfoList arrays;
         ref_ptr<BufferInfo> indices;
 
+        /// optional bound of the vertex array used by RecordTraversal to cull the draw
+        DrawBound drawBound;
+
         void assignArrays(const DataList& in_arrays);
         void assignIndices(ref_ptr<Data> in_indices);
 
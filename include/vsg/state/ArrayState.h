@@ -91,6 +91,10 @@ namespace vsg
 
         virtual ref_ptr<const vec3Array> vertexArray(uint32_t instanceIndex);
 
+        /// return true if the vertices of the specified instance are an affine transform of the vertices array, with the transform assigned to matrix.
+        /// Used by traversals such as ComputeBounds and Intersector to transform their query into the instance's local coordinate frame rather than requiring a transformed copy of the vertices array.
+        virtual bool instanceMatrix(uint32_t instanceIndex, dmat4& matrix);
+
     protected:
         virtual ~ArrayState() {}
     };
@@ -134,6 +138,7 @@ namespace vsg
 
         void apply(const VertexInputState& vas) override;
         ref_ptr<const vec3Array> vertexArray(uint32_t instanceIndex) override;
+        bool instanceMatrix(uint32_t instanceIndex, dmat4& matrix) override;
     };
     VSG_type_name(vsg::TranslationArrayState);
 
@@ -159,6 +164,7 @@ namespace vsg
 
         void apply(const VertexInputState& vas) override;
         ref_ptr<const vec3Array> vertexArray(uint32_t instanceIndex) override;
+        bool instanceMatrix(uint32_t instanceIndex, dmat4& matrix) override;
     };
     VSG_type_name(vsg::TranslationRotationScaleArrayState);
 
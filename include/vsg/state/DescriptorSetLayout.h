@@ -40,6 +40,9 @@ namespace vsg
         /// map the descriptor bindings to the descriptor pool sizes that will be required to represent them.
         void getDescriptorPoolSizes(DescriptorPoolSizes& descriptorPoolSizes);
 
+        /// hash of the bindings, layouts with identical bindings return the same signature so can share recycled DescriptorSets.
+        uint64_t bindingsSignature() const;
+
         // compile the Vulkan object, context parameter used for Device
         virtual void compile(Context& context);
 
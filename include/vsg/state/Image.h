@@ -55,6 +55,9 @@ namespace vsg
 
         VkDeviceSize getMemoryOffset(uint32_t deviceID) const { return _vulkanData[deviceID].memoryOffset; }
 
+        /// size of the device memory reserved for the image, 0 if not yet compiled for the device
+        VkDeviceSize getMemorySize(uint32_t deviceID) const { return _vulkanData[deviceID].size; }
+
         VkMemoryRequirements getMemoryRequirements(uint32_t deviceID) const;
 
         VkResult allocateAndBindMemory(Device* device, VkMemoryPropertyFlags memoryProperties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, void* pNextAllocInfo = nullptr);
@@ -13,8 +13,10 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/app/CommandGraph.h>
+#include <vsg/app/MultiFrustumCull.h>
 #include <vsg/app/RenderGraph.h>
 #include <vsg/io/Logger.h>
+#include <vsg/lighting/LightClusters.h>
 #include <vsg/lighting/Light.h>
 #include <vsg/nodes/Switch.h>
 #include <vsg/state/BindDescriptorSet.h>
@@ -143,6 +145,10 @@ namespace vsg
         ref_ptr<vec4Array> viewportData;
         ref_ptr<BufferInfo> viewportDataBufferInfo;
 
+        /// optional clustered assignment of point and spot lights, assign before init() to enable.
+        /// Requires a ShaderSet with the VSG_CLUSTERED_LIGHTS define and lightClusterParameters, lightClusterGrid and lightClusterIndices descriptors.
+        ref_ptr<LightClusters> lightClusters;
+
         ref_ptr<Image> shadowDepthImage;
 
         ref_ptr<DescriptorSetLayout> descriptorSetLayout;
@@ -153,6 +159,9 @@ namespace vsg
         double shadowMapBias = 0.005;
         double lambda = 0.5;
 
+        /// cull all the shadow map views with a single MultiFrustumCull traversal of the scene graph rather than each shadow map view traversing the scene graph, must be set before init().
+        bool multiFrustumCulling = false;
+
         // map of Light's that we wish to override their ShadowSettings,
         // assigning shadowSettingsOverride[{}] = shadowSettings will override all Light not otherwise explicitly matched.
         std::map<ref_ptr<const Light>, ref_ptr<ShadowSettings>> shadowSettingsOverride;
@@ -168,9 +177,11 @@ namespace vsg
         {
             ref_ptr<RenderGraph> renderGraph;
             ref_ptr<View> view;
+            ref_ptr<DrawList> drawList;
         };
 
         mutable std::vector<ShadowMap> shadowMaps;
+        mutable ref_ptr<MultiFrustumCull> multiFrustumCull;
 
     protected:
         ~ViewDependentState();
@@ -13,31 +13,59 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/threading/ActivityStatus.h>
+#include <vsg/threading/OperationThreads.h>
+#include <vsg/ui/UIEvent.h>
 #include <vsg/utils/SharedObjects.h>
 
 #include <condition_variable>
+#include <deque>
 #include <list>
 
 namespace vsg
 {
 
     /// Thread safe queue deleting nodes/subgraphs as batches, typically done from a background thread.
+    /// Objects are held in contiguous per frame buckets, released once their frame has passed, optionally within a time budget per wake-up and in parallel for large batches.
     class VSG_DECLSPEC DeleteQueue : public Inherit<Object, DeleteQueue>
     {
     public:
         explicit DeleteQueue(ref_ptr<ActivityStatus> status);
 
-        struct ObjectToDelete
+        using Objects = std::vector<ref_ptr<Object>>;
+
+        /// objects that can be deleted once frameCount has been reached
+        struct FrameBucket
         {
             uint64_t frameCount = 0;
-            ref_ptr<Object> object;
+            Objects objects;
         };
 
-        using ObjectsToDelete = std::list<ObjectToDelete>;
+        using FrameBuckets = std::deque<FrameBucket>;
+
+        /// statistics of the objects released by a wait_then_clear() or clear() call
+        struct Statistics
+        {
+            uint64_t frameCount = 0;
+            size_t numObjectsDeleted = 0;
+            size_t numObjectsRemaining = 0;
+
+            /// approximated from the change in vsg::Allocator's available memory, so concurrent allocations on other threads affect the value
+            size_t numBytesDeleted = 0;
+
+            /// time taken to release the objects in milliseconds
+            double duration = 0.0;
+        };
 
         std::atomic_uint64_t frameCount = 0;
         uint64_t retainForFrameCount = 3;
 
+        /// maximum time in milliseconds to spend releasing objects on each wake-up, objects not released within the budget are retained for the next wake-up, 0.0 for no limit.
+        double timeBudget = 0.0;
+
+        /// optional threads used to release batches of more than parallelReleaseThreshold objects in parallel, with the calling thread also taking part.
+        ref_ptr<OperationThreads> operationThreads;
+        size_t parallelReleaseThreshold = 4096;
+
         ActivityStatus* getStatus() { return _status; }
         const ActivityStatus* getStatus() const { return _status; }
 
@@ -46,7 +74,7 @@ namespace vsg
         void add(ref_ptr<Object> object)
         {
             std::scoped_lock lock(_mutex);
-            _objectsToDelete.push_back(ObjectToDelete{frameCount + retainForFrameCount, object});
+            _bucket(frameCount + retainForFrameCount).push_back(object);
             _cv.notify_one();
         }
 
@@ -56,9 +84,10 @@ namespace vsg
             std::scoped_lock lock(_mutex);
 
             // register the Objects to delete
+            auto& bucket = _bucket(frameCount + retainForFrameCount);
             for (auto& object : objects)
             {
-                _objectsToDelete.emplace_back(ObjectToDelete{frameCount + retainForFrameCount, object});
+                bucket.emplace_back(object);
             }
 
             _cv.notify_one();
@@ -98,9 +127,10 @@ namespace vsg
             std::scoped_lock lock(_mutex);
 
             // register the Objects to delete
+            auto& bucket = _bucket(frameCount + retainForFrameCount);
             for (auto& object : objects)
             {
-                _objectsToDelete.emplace_back(ObjectToDelete{frameCount + retainForFrameCount, object});
+                bucket.emplace_back(object);
             }
 
             // register the SharedObjects to call prune on
@@ -116,13 +146,24 @@ namespace vsg
 
         void clear();
 
+        /// return the statistics of the most recent wait_then_clear() or clear() call
+        Statistics getStatistics() const;
+
     protected:
         virtual ~DeleteQueue();
 
-        std::mutex _mutex;
+        /// return the objects container of the bucket for the specified frame, adding a bucket when required, caller must hold _mutex.
+        Objects& _bucket(uint64_t bucketFrameCount);
+
+        /// release the objects, returning the number released, stopping early if the deadline is passed and leaving the remaining objects in the container.
+        size_t _release(Objects& objects, const clock::time_point* deadline);
+
+        mutable std::mutex _mutex;
         std::condition_variable _cv;
-        ObjectsToDelete _objectsToDelete;
+        FrameBuckets _frameBuckets;
+        std::vector<Objects> _recycledObjects;
         std::list<ref_ptr<SharedObjects>> _sharedObjectsToPrune;
+        Statistics _statistics;
 
         ref_ptr<ActivityStatus> _status;
     };
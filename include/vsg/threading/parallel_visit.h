@@ -0,0 +1,121 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/nodes/Node.h>
+#include <vsg/threading/OperationThreads.h>
+
+#include <algorithm>
+#include <atomic>
+
+namespace vsg
+{
+
+    /// SubgraphPartition splits a scene graph into subgraphs that can be traversed independently of each other.
+    /// Only plain Group, QuadGroup and optionally LOD nodes are split as they don't modify the traversal state, all other nodes, including Group subclasses such as StateGroup and Transform, are kept whole.
+    /// The split nodes themselves are not visited, so visitors that need to apply() these node types must not be used with parallel_visit().
+    struct VSG_DECLSPEC SubgraphPartition
+    {
+        /// number of subgraphs to aim for per thread, larger values improve load balancing at the cost of more scheduling overhead
+        uint32_t tasksPerThread = 4;
+
+        /// split LOD nodes, traversing all their children, set to false for visitors that handle LOD nodes themselves
+        bool partitionLOD = true;
+
+        /// return true if the node will be split into its children
+        bool partitionable(const Node& node) const;
+
+        /// split node breadth first until the number of subgraphs reaches targetNumTasks or no more nodes can be split.
+        void partition(const Node& node, size_t targetNumTasks, std::vector<const Node*>& tasks) const;
+    };
+
+    /// helper function that partitions a subgraph with SubgraphPartition, traverses the resulting subgraphs with clones of the visitor on the operationThreads,
+    /// with this thread also taking part, then merges the results of each clone into the visitor by calling reduce(visitor, clone).
+    /// Each thread takes the next untraversed subgraph from a shared counter so threads that finish early take on the remaining work.
+    /// clone(visitor) must return a ref_ptr<V> with the visitor's traversal state but empty results, it may be called concurrently from several threads.
+    /// usage:
+    ///     vsg::parallel_visit(visitor, *scene, operationThreads, clone, reduce);
+    template<class V, class Clone, class Reduce>
+    V& parallel_visit(V& visitor, const Node& node, OperationThreads* operationThreads, Clone clone, Reduce reduce, const SubgraphPartition& subgraphPartition = {})
+    {
+        if (!operationThreads || operationThreads->threads.empty())
+        {
+            node.accept(visitor);
+            return visitor;
+        }
+
+        size_t numWorkers = operationThreads->threads.size() + 1;
+
+        std::vector<const Node*> tasks;
+        subgraphPartition.partition(node, numWorkers * subgraphPartition.tasksPerThread, tasks);
+        if (tasks.size() <= 1)
+        {
+            node.accept(visitor);
+            return visitor;
+        }
+
+        numWorkers = std::min(numWorkers, tasks.size());
+
+        struct VisitOperation : public Operation
+        {
+            VisitOperation(const V& v, Clone& c, const std::vector<const Node*>& t, std::atomic_size_t& n, ref_ptr<Latch> l) :
+                visitor(v),
+                clone(c),
+                tasks(t),
+                nextTask(n),
+                latch(l) {}
+
+            void run() override
+            {
+                for (size_t i = nextTask++; i < tasks.size(); i = nextTask++)
+                {
+                    if (!result) result = clone(visitor);
+                    tasks[i]->accept(*result);
+                }
+                latch->count_down();
+            }
+
+            const V& visitor;
+            Clone& clone;
+            const std::vector<const Node*>& tasks;
+            std::atomic_size_t& nextTask;
+            ref_ptr<Latch> latch;
+            ref_ptr<V> result;
+        };
+
+        std::atomic_size_t nextTask = 0;
+        auto latch = Latch::create(numWorkers);
+
+        std::vector<ref_ptr<VisitOperation>> operations;
+        for (size_t i = 0; i < numWorkers; ++i)
+        {
+            auto operation = ref_ptr<VisitOperation>(new VisitOperation(visitor, clone, tasks, nextTask, latch));
+            operations.push_back(operation);
+            operationThreads->add(operation);
+        }
+
+        // use this thread to traverse subgraphs as well
+        operationThreads->run();
+
+        // wait till all the operations have completed
+        latch->wait();
+
+        for (auto& operation : operations)
+        {
+            if (operation->result) reduce(visitor, *(operation->result));
+        }
+
+        return visitor;
+    }
+
+} // namespace vsg
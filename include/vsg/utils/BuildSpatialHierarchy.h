@@ -0,0 +1,84 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Inherit.h>
+#include <vsg/core/Visitor.h>
+#include <vsg/maths/box.h>
+#include <vsg/nodes/Group.h>
+#include <vsg/threading/OperationThreads.h>
+
+#include <set>
+
+namespace vsg
+{
+
+    /// BuildSpatialHierarchy visitor rebuilds groups with many children into a bounding volume hierarchy of CullGroups so that the RecordTraversal can cull whole branches of the scene graph
+    /// rather than bound testing every child. The rebuilt group keeps its type and state, only its children are replaced with the top level of the hierarchy.
+    /// Groups are only rebuilt when all their children have valid bounds, so order dependent children such as StateCommands leave the group unchanged.
+    class VSG_DECLSPEC BuildSpatialHierarchy : public Inherit<Visitor, BuildSpatialHierarchy>
+    {
+    public:
+        BuildSpatialHierarchy();
+
+        enum SplitMethod
+        {
+            MEDIAN_SPLIT,          // split at the median child center along the longest axis
+            SURFACE_AREA_HEURISTIC // split where the binned surface area heuristic is minimized
+        };
+
+        SplitMethod splitMethod = SURFACE_AREA_HEURISTIC;
+
+        /// groups with fewer children are left unchanged
+        uint32_t minimumChildren = 32;
+
+        /// maximum number of children in the leaf CullGroups of the hierarchy
+        uint32_t maximumLeafChildren = 8;
+
+        /// number of children of each internal CullGroup, 2 for a binary tree, 4 for a quadtree like and 8 for an octree like hierarchy
+        uint32_t branchingFactor = 2;
+
+        /// use the bounding volumes of Cull/LOD nodes etc. when computing the bounds of children
+        bool useNodeBounds = true;
+
+        /// optional threads used to compute the bounds of the children in parallel, with this thread also taking part
+        ref_ptr<OperationThreads> operationThreads;
+
+        /// statistics collected during the traversal
+        uint32_t numGroupsRebuilt = 0;
+        uint32_t numCullGroupsCreated = 0;
+
+        void apply(Object& object) override;
+        void apply(Group& group) override;
+        void apply(CommandGraph& commandGraph) override;
+        void apply(RenderGraph& renderGraph) override;
+        void apply(View& view) override;
+
+    protected:
+        struct Item
+        {
+            ref_ptr<Node> node;
+            dbox bounds;
+            dvec3 center;
+        };
+        using Items = std::vector<Item>;
+
+        bool _computeBounds(const Group& group, Items& items);
+        ref_ptr<Node> _build(Items::iterator begin, Items::iterator end);
+        Items::iterator _split(Items::iterator begin, Items::iterator end);
+
+        std::set<Group*> _visited;
+    };
+    VSG_type_name(vsg::BuildSpatialHierarchy);
+
+} // namespace vsg
@@ -70,6 +70,9 @@ namespace vsg
         /// cullNode flag indicates whether a CullNode should decorate the created subgraph
         bool cullNode = false;
 
+        /// drawBound flag indicates whether the created drawable should be culled against the bound of its vertices, ignored for instanced or displacement mapped geometry
+        bool drawBound = false;
+
         template<typename T>
         void set(const t_box<T>& bb)
         {
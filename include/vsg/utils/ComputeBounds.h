@@ -14,10 +14,64 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/maths/box.h>
 #include <vsg/state/ArrayState.h>
+#include <vsg/threading/OperationThreads.h>
+
+#include <map>
+#include <mutex>
 
 namespace vsg
 {
 
+    /// BoundsCache is a side table of local coordinate bounding boxes of vertex/index array ranges, used by ComputeBounds to avoid recomputing the bounds of geometry that hasn't changed.
+    /// Entries are invalidated when the ModifiedCount of the vertex or index array changes, so Data::dirty() must be called after modifying the arrays.
+    class VSG_DECLSPEC BoundsCache : public Inherit<Object, BoundsCache>
+    {
+    public:
+        struct Key
+        {
+            ref_ptr<const Data> vertices;
+            ref_ptr<const Data> indices;
+            uint32_t first = 0;
+            uint32_t count = 0;
+
+            bool operator<(const Key& rhs) const
+            {
+                if (vertices < rhs.vertices) return true;
+                if (rhs.vertices < vertices) return false;
+                if (indices < rhs.indices) return true;
+                if (rhs.indices < indices) return false;
+                if (first < rhs.first) return true;
+                if (rhs.first < first) return false;
+                return count < rhs.count;
+            }
+        };
+
+        struct Entry
+        {
+            ModifiedCount verticesModifiedCount;
+            ModifiedCount indicesModifiedCount;
+            dbox bounds;
+        };
+
+        /// get the cached bounds, return false if no entry exists or the arrays have been modified since the bounds were computed.
+        bool get(const Key& key, dbox& bounds) const;
+
+        /// assign the bounds for the specified arrays and range
+        void set(const Key& key, const dbox& bounds);
+
+        /// remove entries whose arrays are only referenced by the cache, return the number of entries removed.
+        size_t prune();
+
+        void clear();
+
+        size_t size() const;
+
+    protected:
+        mutable std::mutex _mutex;
+        std::map<Key, Entry> _entries;
+    };
+    VSG_type_name(vsg::BoundsCache);
+
     /// ComputeBounds traverses a scene graph computing an overall bounding box that encloses all the geometry in that scene graph.
     class VSG_DECLSPEC ComputeBounds : public Inherit<ConstVisitor, ComputeBounds>
     {
@@ -43,6 +97,14 @@ namespace vsg
         ref_ptr<const ushortArray> ushort_indices;
         ref_ptr<const uintArray> uint_indices;
 
+        /// optional cache of the local bounds of drawables so that only modified geometry is recomputed on subsequent traversals.
+        /// Cached local bounds are transformed as a box, so rotated geometry may have looser bounds than when computed from the transformed vertices.
+        ref_ptr<BoundsCache> boundsCache;
+
+        /// optional threads used to compute the bounds of vertex ranges larger than parallelVertexThreshold, with this thread also taking part.
+        ref_ptr<OperationThreads> operationThreads;
+        uint32_t parallelVertexThreshold = 65536;
+
         void apply(const Object& node) override;
         void apply(const StateGroup& stategroup) override;
         void apply(const Transform& transform) override;
@@ -75,6 +137,17 @@ namespace vsg
 
         void add(const dbox& bb);
         void add(const dsphere& bs);
+
+        /// traverse the node's subgraph, using parallel_visit() to traverse independent subgraphs on the operationThreads when assigned, merging the bounds of each subgraph into bounds.
+        void traverseInParallel(const Node& node);
+
+    protected:
+        /// add the bounds of the vertex range, or indexed vertex range when indexed is true, transformed by matrix, using the bounds cache and operation threads when available.
+        /// cacheable should be false when the vertices are a temporary per instance copy.
+        void addVertices(ref_ptr<const vec3Array> vertices, bool cacheable, bool indexed, uint32_t first, uint32_t count, const dmat4& matrix);
+
+        /// compute the bounds of the vertex range, in parallel when operationThreads are assigned and the range exceeds parallelVertexThreshold, vertices are transformed by matrix when it is non null.
+        dbox computeVertexBounds(const vec3Array& vertices, bool indexed, uint32_t first, uint32_t count, const dmat4* matrix);
     };
     VSG_type_name(vsg::ComputeBounds);
 
@@ -0,0 +1,42 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Inherit.h>
+#include <vsg/core/Visitor.h>
+#include <vsg/nodes/DrawBound.h>
+
+namespace vsg
+{
+
+    /// ComputeDrawBounds visitor enables the DrawBound of the VertexDraw, VertexIndexDraw and Geometry leaves in a scene graph and precomputes their bounds,
+    /// so that RecordTraversal can cull them without the subgraph needing to be decorated with CullNode.
+    /// Instanced draws and the subgraphs of InstanceNode are skipped as their vertex arrays don't bound the rendered geometry.
+    class VSG_DECLSPEC ComputeDrawBounds : public Inherit<Visitor, ComputeDrawBounds>
+    {
+    public:
+        /// number of draws that have had their DrawBound enabled
+        uint32_t numDrawBoundsEnabled = 0;
+
+        void apply(Node& node) override;
+        void apply(InstanceNode& instanceNode) override;
+        void apply(VertexDraw& vd) override;
+        void apply(VertexIndexDraw& vid) override;
+        void apply(Geometry& geometry) override;
+
+    protected:
+        void enable(DrawBound& drawBound, const BufferInfoList& arrays);
+    };
+    VSG_type_name(vsg::ComputeDrawBounds);
+
+} // namespace vsg
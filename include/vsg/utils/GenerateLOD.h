@@ -0,0 +1,59 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Array.h>
+#include <vsg/core/Inherit.h>
+#include <vsg/nodes/LOD.h>
+#include <vsg/threading/OperationThreads.h>
+
+namespace vsg
+{
+
+    /// GenerateLOD creates a vsg::LOD from a subgraph, with the original subgraph as the highest resolution child followed by copies of the subgraph whose VertexIndexDraw and Geometry meshes have been decimated
+    /// by quadric error metric edge collapses. Decimated meshes share the vertex arrays of the original, only new index arrays are created.
+    /// Results are deterministic, with meshes simplified in parallel when operationThreads are assigned.
+    class VSG_DECLSPEC GenerateLOD : public Inherit<Object, GenerateLOD>
+    {
+    public:
+        GenerateLOD();
+
+        struct Level
+        {
+            double minimumScreenHeightRatio = 0.0; // screen height ratio above which the level is visible
+            float targetRatio = 0.5f;              // target fraction of the original triangles
+            float targetError = 0.01f;             // maximum error relative to the radius of the mesh bounds
+        };
+
+        /// screen height ratio above which the original subgraph is visible
+        double minimumScreenHeightRatio = 0.5;
+
+        /// decimated levels, from highest to lowest resolution
+        std::vector<Level> levels;
+
+        ref_ptr<OperationThreads> operationThreads;
+
+        /// return an LOD with the subgraph and its decimated copies as children
+        ref_ptr<LOD> generate(ref_ptr<Node> subgraph);
+
+        /// simplify a triangle list referencing vertices[index + vertexOffset], returning the decimated indices in an array of the same type as indices, or null if the indices type isn't supported.
+        /// Vertices with the same position but different attributes, and vertices on mesh borders, are kept in place so that texture seams and borders are preserved.
+        /// When normals are provided collapses between vertices with differing normals are penalized.
+        static ref_ptr<Data> simplify(const vec3Array& vertices, const vec3Array* normals, const Data& indices, uint32_t firstIndex, uint32_t indexCount, uint32_t vertexOffset, float targetRatio, float targetError);
+
+    protected:
+        virtual ~GenerateLOD();
+    };
+    VSG_type_name(vsg::GenerateLOD);
+
+} // namespace vsg
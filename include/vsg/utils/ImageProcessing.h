@@ -0,0 +1,38 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Data.h>
+#include <vsg/threading/OperationThreads.h>
+
+namespace vsg
+{
+
+    /// return a copy of a 2D ubvec4Array2D image, of format VK_FORMAT_R8G8B8A8_UNORM/SRGB or VK_FORMAT_B8G8R8A8_UNORM/SRGB, with the full mipmap chain stored in the Data's mipmap layout so that no mipmaps need to be generated on the GPU at upload.
+    /// Mipmaps are box filtered, in linear color space for sRGB formats. Rows are processed in parallel when operationThreads are provided.
+    /// Returns null if the image type or format is not supported.
+    extern VSG_DECLSPEC ref_ptr<Data> generateMipmaps(ref_ptr<const Data> image, OperationThreads* operationThreads = nullptr);
+
+    enum class BlockCompression
+    {
+        BC1, // RGB, 4 bits per pixel, alpha is discarded
+        BC3, // RGBA, 8 bits per pixel, with interpolated alpha
+        BC7  // RGBA, 8 bits per pixel, encoded using mode 6 for better color precision than BC3
+    };
+
+    /// return a block compressed copy of a 2D ubvec4Array2D image, of format VK_FORMAT_R8G8B8A8_UNORM/SRGB or VK_FORMAT_B8G8R8A8_UNORM/SRGB, compressing each mipmap level of the image when it has them.
+    /// Mipmap levels smaller than a single block, or whose block count no longer halves, as with non power of two images, are dropped to match the Data mipmap layout of block compressed data. Blocks are encoded in parallel when operationThreads are provided.
+    /// Returns null if the image type or format is not supported.
+    extern VSG_DECLSPEC ref_ptr<Data> compressImage(ref_ptr<const Data> image, BlockCompression compression, OperationThreads* operationThreads = nullptr);
+
+} // namespace vsg
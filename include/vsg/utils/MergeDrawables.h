@@ -0,0 +1,68 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Inherit.h>
+#include <vsg/core/Visitor.h>
+#include <vsg/maths/box.h>
+#include <vsg/maths/mat4.h>
+#include <vsg/nodes/Group.h>
+
+#include <set>
+
+namespace vsg
+{
+
+    /// MergeDrawables visitor reduces the number of draw calls in a scene graph by concatenating sibling VertexIndexDraw and Geometry nodes that share the same vertex layout into single VertexIndexDraw nodes,
+    /// rebasing their indices to the merged vertex arrays. Sibling StateGroups with equal stateCommands are combined first so that drawables under identical state can be merged.
+    /// Drawables are sorted spatially and split into batches of no more than maxVerticesPerBatch vertices, each batch is optionally decorated with a CullNode so that view frustum culling remains effective.
+    /// Drawables that use dynamic data, instancing or vertex array types that can't be concatenated are left unchanged.
+    class VSG_DECLSPEC MergeDrawables : public Inherit<Visitor, MergeDrawables>
+    {
+    public:
+        MergeDrawables();
+
+        /// bake the matrices of MatrixTransforms that only contain mergeable drawables into the vertex positions, arrays[0], and normals, arrays[1] when a vec3Array, so they can be merged with their siblings.
+        /// Only enable when no MatrixTransform in the scene graph is animated.
+        bool bakeTransforms = false;
+
+        /// combine sibling StateGroups with equal stateCommands
+        bool mergeStateGroups = true;
+
+        /// maximum number of vertices in a merged drawable
+        uint32_t maxVerticesPerBatch = 65536;
+
+        /// decorate each merged drawable with a CullNode
+        bool addCullNodes = true;
+
+        /// statistics collected during the traversal
+        uint32_t numDrawablesMerged = 0;
+        uint32_t numDrawablesCreated = 0;
+        uint32_t numStateGroupsMerged = 0;
+
+        void apply(Object& object) override;
+        void apply(Group& group) override;
+
+    protected:
+        struct Drawable;
+
+        void _mergeStateGroups(Group& group);
+        void _mergeDrawables(Group& group);
+        bool _collect(Node* node, const dmat4* matrix, std::vector<Drawable>& drawables);
+        ref_ptr<Node> _merge(std::vector<Drawable*>& batch);
+
+        std::set<Group*> _visited;
+    };
+    VSG_type_name(vsg::MergeDrawables);
+
+} // namespace vsg
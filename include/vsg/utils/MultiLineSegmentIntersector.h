@@ -0,0 +1,81 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/threading/OperationThreads.h>
+#include <vsg/utils/LineSegmentIntersector.h>
+
+namespace vsg
+{
+
+    /// MultiLineSegmentIntersector is an Intersector subclass that intersects a batch of line segments with the scene graph in a single traversal.
+    /// The line segments are carried down the scene graph together, with only the line segments that intersect a node's bounding sphere being passed on to its subgraph,
+    /// providing per line segment intersections equivalent to running a LineSegmentIntersector for each line segment.
+    class VSG_DECLSPEC MultiLineSegmentIntersector : public Inherit<Intersector, MultiLineSegmentIntersector>
+    {
+    public:
+        struct LineSegment
+        {
+            dvec3 start;
+            dvec3 end;
+        };
+
+        using LineSegments = std::vector<LineSegment>;
+        using Intersection = LineSegmentIntersector::Intersection;
+        using Intersections = LineSegmentIntersector::Intersections;
+
+        explicit MultiLineSegmentIntersector(const LineSegments& in_lineSegments, ref_ptr<ArrayState> initialArrayData = {});
+
+        /// line segments in world coordinates, assigned by the constructor
+        LineSegments lineSegments;
+
+        /// intersections for each line segment, indexed by the line segment's position in lineSegments
+        std::vector<Intersections> intersections;
+
+        ref_ptr<Intersection> add(uint32_t lineSegmentIndex, const dvec3& coord, double ratio, const IndexRatios& indexRatios, uint32_t instanceIndex);
+
+        /// intersect the subgraph, if operationThreads are assigned the line segments are split into batches that are intersected in parallel,
+        /// with this thread also taking part, and the results merged into intersections once all batches have completed.
+        void intersect(const Node& node, ref_ptr<OperationThreads> operationThreads = {}, size_t minimumBatchSize = 256);
+
+        void apply(const LOD& lod) override;
+        void apply(const PagedLOD& plod) override;
+        void apply(const CullNode& cn) override;
+        void apply(const CullGroup& cg) override;
+        void apply(const DepthSorted& ds) override;
+
+        void pushTransform(const Transform& transform) override;
+        void popTransform() override;
+
+        /// check for intersection of any of the active line segments with sphere
+        bool intersects(const dsphere& bs) override;
+
+        bool intersectDraw(uint32_t firstVertex, uint32_t vertexCount, uint32_t firstInstance, uint32_t instanceCount) override;
+        bool intersectDrawIndexed(uint32_t firstIndex, uint32_t indexCount, uint32_t firstInstance, uint32_t instanceCount) override;
+
+    protected:
+        using Indices = std::vector<uint32_t>;
+
+        /// push the subset of the active line segments that intersect the sphere, return false and leave the active stack unchanged if none do.
+        bool pushActive(const dsphere& bs);
+        void popActive();
+
+        /// local coordinate line segments for each transform level, indexed by line segment index, only entries for active line segments are maintained
+        std::vector<LineSegments> _lineSegmentsStack;
+
+        /// indices of the line segments active for the current subgraph
+        std::vector<Indices> _activeStack;
+    };
+    VSG_type_name(vsg::MultiLineSegmentIntersector);
+
+} // namespace vsg
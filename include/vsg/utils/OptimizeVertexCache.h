@@ -0,0 +1,95 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Inherit.h>
+#include <vsg/core/Visitor.h>
+#include <vsg/state/BufferInfo.h>
+#include <vsg/vk/vulkan.h>
+
+#include <set>
+
+namespace vsg
+{
+
+    /// OptimizeVertexCache visitor reorders the triangles of indexed VertexIndexDraw and Geometry nodes to improve post transform vertex cache reuse, using Forsyth's linear speed vertex cache optimisation,
+    /// then optionally reorders the vertices into first use order to improve vertex fetch locality.
+    /// Only triangle lists are optimized, the primitive topology is taken from the GraphicsPipelines bound by StateGroups, with defaultTopology used when no pipeline has been encountered.
+    class VSG_DECLSPEC OptimizeVertexCache : public Inherit<Visitor, OptimizeVertexCache>
+    {
+    public:
+        OptimizeVertexCache();
+
+        /// simulated FIFO post transform cache statistics of a triangle list
+        struct CacheStatistics
+        {
+            uint64_t numTriangles = 0;
+            uint64_t numVertices = 0;
+            uint64_t numCacheMisses = 0;
+
+            /// average cache miss ratio, the number of vertex shader invocations per triangle, 0.5 is optimal for large regular meshes, 3.0 the worst case.
+            double acmr() const { return numTriangles > 0 ? static_cast<double>(numCacheMisses) / static_cast<double>(numTriangles) : 0.0; }
+
+            /// average transformed vertex ratio, the number of vertex shader invocations per referenced vertex, 1.0 is optimal.
+            double atvr() const { return numVertices > 0 ? static_cast<double>(numCacheMisses) / static_cast<double>(numVertices) : 0.0; }
+
+            CacheStatistics& operator+=(const CacheStatistics& rhs)
+            {
+                numTriangles += rhs.numTriangles;
+                numVertices += rhs.numVertices;
+                numCacheMisses += rhs.numCacheMisses;
+                return *this;
+            }
+        };
+
+        /// simulate a FIFO vertex cache of cacheSize entries for the triangle list in the specified range of a ubyteArray, ushortArray or uintArray of indices.
+        static CacheStatistics analyze(const Data& indices, uint32_t firstIndex, uint32_t indexCount, uint32_t cacheSize);
+
+        /// size of the vertex cache to optimize for
+        uint32_t cacheSize = 32;
+
+        /// size of the FIFO cache used when collecting statistics
+        uint32_t statisticsCacheSize = 16;
+
+        /// reorder vertex arrays into the order they are first referenced by the optimized indices. Skipped for vertex arrays that are shared with other objects.
+        bool reorderVertices = true;
+
+        /// topology to assume when no GraphicsPipeline has been encountered
+        VkPrimitiveTopology defaultTopology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+        /// statistics of the index ranges before and after optimization
+        CacheStatistics before;
+        CacheStatistics after;
+        uint32_t numDrawablesOptimized = 0;
+
+        void apply(Object& object) override;
+        void apply(StateGroup& stateGroup) override;
+        void apply(VertexIndexDraw& vid) override;
+        void apply(Geometry& geometry) override;
+
+    protected:
+        struct Range
+        {
+            uint32_t firstIndex;
+            uint32_t indexCount;
+            uint32_t vertexOffset;
+        };
+
+        void _optimize(BufferInfoList& arrays, Data& indices, const std::vector<Range>& ranges, bool vertexOrderIndependent);
+
+        std::vector<VkPrimitiveTopology> _topologyStack;
+        std::set<const Data*> _optimized;
+    };
+    VSG_type_name(vsg::OptimizeVertexCache);
+
+} // namespace vsg
@@ -14,6 +14,10 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <vsg/io/stream.h>
 #include <vsg/state/DescriptorSet.h>
+#include <vsg/vk/DescriptorPoolAccounting.h>
+
+#include <list>
+#include <unordered_map>
 
 namespace vsg
 {
@@ -59,10 +63,12 @@ namespace vsg
         VkDescriptorPool _descriptorPool;
         ref_ptr<Device> _device;
 
-        uint32_t _availableDescriptorSet;
-        DescriptorPoolSizes _availableDescriptorPoolSizes;
+        /// device independent bookkeeping of the available sets and descriptors
+        DescriptorPoolAccounting _accounting;
 
-        std::list<ref_ptr<DescriptorSet::Implementation>> _recyclingList;
+        /// freed DescriptorSet::Implementation indexed by DescriptorSetLayout::bindingsSignature() so compatible sets can be found without a linear search.
+        using RecyclingList = std::list<ref_ptr<DescriptorSet::Implementation>>;
+        std::unordered_map<uint64_t, RecyclingList> _recyclingLists;
     };
     VSG_type_name(vsg::DescriptorPool);
 
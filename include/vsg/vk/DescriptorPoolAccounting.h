@@ -0,0 +1,60 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/state/DescriptorSetLayout.h>
+
+namespace vsg
+{
+
+    /// DescriptorPoolAccounting tracks the DescriptorSets and descriptors available in a DescriptorPool.
+    /// It makes no Vulkan calls so the bookkeeping can be used, tested and benchmarked without a Device.
+    class VSG_DECLSPEC DescriptorPoolAccounting
+    {
+    public:
+        DescriptorPoolAccounting(uint32_t in_maxSets, const DescriptorPoolSizes& in_descriptorPoolSizes);
+
+        const uint32_t maxSets = 0;
+        const DescriptorPoolSizes descriptorPoolSizes;
+
+        /// number of sets available, including recycled sets
+        uint32_t availableSets() const { return _availableSets; }
+
+        /// number of freed sets held for reuse by a compatible DescriptorSetLayout
+        uint32_t recycledSets() const { return _numRecycled; }
+
+        /// descriptors not yet consumed by newly allocated sets
+        const DescriptorPoolSizes& availableDescriptorPoolSizes() const { return _availableDescriptorPoolSizes; }
+
+        /// return true if sets can still be allocated without reusing a recycled set
+        bool newSetsAvailable() const { return _availableSets > _numRecycled; }
+
+        /// consume a new set and its descriptors, return false leaving the counts unchanged if there aren't enough available.
+        bool allocate(const DescriptorPoolSizes& requiredDescriptorPoolSizes);
+
+        /// record a set being freed for later reuse
+        void recycle();
+
+        /// record a recycled set being reused
+        void reuse();
+
+        /// compute the number of sets and descriptors used.
+        bool used(uint32_t& numSets, DescriptorPoolSizes& usedDescriptorPoolSizes) const;
+
+    protected:
+        uint32_t _availableSets = 0;
+        uint32_t _numRecycled = 0;
+        DescriptorPoolSizes _availableDescriptorPoolSizes;
+    };
+
+} // namespace vsg
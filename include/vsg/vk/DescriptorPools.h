@@ -16,6 +16,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/vk/DescriptorPool.h>
 #include <vsg/vk/ResourceRequirements.h>
 
+#include <unordered_map>
+
 namespace vsg
 {
 
@@ -26,6 +28,8 @@ namespace vsg
         explicit DescriptorPools(ref_ptr<Device> in_device);
 
         ref_ptr<Device> device;
+
+        /// all the DescriptorPools, both those allocated by reserve(..) and those allocated for a specific DescriptorSetLayout signature.
         std::list<ref_ptr<DescriptorPool>> descriptorPools;
 
         uint32_t minimum_maxSets = 0;    // minimum value of maxSets when allocating new DescriptoPool.
@@ -55,11 +59,26 @@ namespace vsg
         /// compute the number of sets and descriptors allocated.
         bool allocated(uint32_t& numSets, DescriptorPoolSizes& descriptorPoolSizes) const;
 
+        /// mutex used to ensure thread safe access of DescriptorPools, as they are shared between the Context of each thread compiling to the same Device.
+        /// Locked automatically by reserve(..), allocateDescriptorSet(..), available(..), used(..) and allocated(..).
+        mutable std::mutex mutex;
+
     protected:
         virtual ~DescriptorPools();
 
         /// get the maxSets and descriptorPoolSizes to use
         void getDescriptorPoolSizesToUse(uint32_t& maxSets, DescriptorPoolSizes& descriptorPoolSizes);
+
+        /// DescriptorPools sized for the sets of a single DescriptorSetLayout::bindingsSignature(), allocated when no other pool could accommodate a set.
+        struct SignatureBucket
+        {
+            std::vector<ref_ptr<DescriptorPool>> descriptorPools;
+            uint32_t nextMaxSets = 1;
+        };
+        std::unordered_map<uint64_t, SignatureBucket> _signatureBuckets;
+
+        /// DescriptorPools allocated by reserve(..) to accommodate the combined requirements of a subgraph.
+        std::vector<ref_ptr<DescriptorPool>> _reservedPools;
     };
     VSG_type_name(vsg::DescriptorPools);
 
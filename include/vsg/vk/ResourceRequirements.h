@@ -152,4 +152,30 @@ namespace vsg
     };
     VSG_type_name(vsg::CollectResourceRequirements);
 
+    /// CollectMemoryUsage is a visitor class that estimates the CPU memory used by the Data, and the device memory reserved for the buffers and images, of a compiled scene graph.
+    /// Each Data, buffer reservation and Image is only counted once per traversal.
+    class VSG_DECLSPEC CollectMemoryUsage : public Inherit<CollectResourceRequirements, CollectMemoryUsage>
+    {
+    public:
+        explicit CollectMemoryUsage(uint32_t in_deviceID = 0) :
+            deviceID(in_deviceID) {}
+
+        /// device to query image memory reservations for
+        uint32_t deviceID = 0;
+
+        VkDeviceSize dataSize = 0;
+        VkDeviceSize deviceMemorySize = 0;
+
+        using CollectResourceRequirements::apply;
+
+        void apply(ref_ptr<BufferInfo> bufferInfo) override;
+        void apply(ref_ptr<ImageInfo> imageInfo) override;
+
+    protected:
+        std::set<const Object*> _visited;
+
+        void addData(const Data* data);
+    };
+    VSG_type_name(vsg::CollectMemoryUsage);
+
 } // namespace vsg
@@ -102,7 +102,7 @@ void Animation::write(Output& output) const
 double Animation::maxTime() const
 {
     double mt = 0.0;
-    for (auto sampler : samplers)
+    for (const auto& sampler : samplers)
     {
         mt = std::max(mt, sampler->maxTime());
     }
@@ -159,7 +159,7 @@ bool Animation::update(double simulationTime)
         }
     }
 
-    for (auto sampler : samplers)
+    for (auto& sampler : samplers)
     {
         sampler->update(samplerTime);
     }
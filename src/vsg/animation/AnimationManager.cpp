@@ -11,9 +11,65 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/animation/AnimationManager.h>
+#include <vsg/animation/CameraSampler.h>
+#include <vsg/animation/JointSampler.h>
+#include <vsg/animation/MorphSampler.h>
+#include <vsg/animation/TransformSampler.h>
+#include <vsg/threading/Latch.h>
+#include <vsg/ui/UIEvent.h>
+
+#include <map>
 
 using namespace vsg;
 
+namespace
+{
+    /// collect the objects that a sampler writes to or reads from, returns false if the sampler type isn't known so its targets can't be determined
+    bool collectTargets(AnimationSampler& sampler, std::vector<const Object*>& targets, std::vector<const Node*>& transforms)
+    {
+        if (auto transformSampler = sampler.cast<TransformSampler>())
+        {
+            targets.push_back(transformSampler->object.get());
+        }
+        else if (auto jointSampler = sampler.cast<JointSampler>())
+        {
+            targets.push_back(jointSampler->jointMatrices.get());
+            targets.push_back(jointSampler->subgraph.get());
+
+            // the joint and transform matrices are read, so group with any TransformSampler animating them
+            transforms.clear();
+            jointSampler->getTransforms(transforms);
+            targets.insert(targets.end(), transforms.begin(), transforms.end());
+        }
+        else if (auto morphSampler = sampler.cast<MorphSampler>())
+        {
+            targets.push_back(morphSampler->object.get());
+            targets.push_back(morphSampler->vertices.get());
+            targets.push_back(morphSampler->normals.get());
+            targets.push_back(morphSampler->weights.get());
+        }
+        else if (auto cameraSampler = sampler.cast<CameraSampler>())
+        {
+            targets.push_back(cameraSampler->object.get());
+        }
+        else
+        {
+            return false;
+        }
+        return true;
+    }
+
+    size_t findRoot(std::vector<size_t>& parents, size_t i)
+    {
+        while (parents[i] != i)
+        {
+            parents[i] = parents[parents[i]];
+            i = parents[i];
+        }
+        return i;
+    }
+} // namespace
+
 AnimationManager::AnimationManager()
 {
 }
@@ -79,15 +135,146 @@ void AnimationManager::run(vsg::ref_ptr<vsg::FrameStamp> frameStamp)
 {
     CPU_INSTRUMENTATION_L1_NC(instrumentation, "AnimationManager run animation updates", COLOR_VIEWER);
 
+    auto startTime = clock::now();
+
     _simulationTime = frameStamp->simulationTime;
 
-    for (auto itr = animations.begin(); itr != animations.end();)
+    if (!_parallelUpdate())
+    {
+        for (auto itr = animations.begin(); itr != animations.end();)
+        {
+            if (update(**itr))
+                ++itr;
+            else
+            {
+                itr = animations.erase(itr);
+            }
+        }
+    }
+
+    updateDuration = std::chrono::duration<double>(clock::now() - startTime).count();
+
+    if (instrumentation)
     {
-        if (update(**itr))
+        instrumentation->plot("AnimationManager updateDuration", updateDuration);
+        instrumentation->plot("AnimationManager numAnimations", static_cast<double>(animations.size()));
+    }
+}
+
+bool AnimationManager::_parallelUpdate()
+{
+    if (!operationThreads || operationThreads->threads.empty() || animations.size() < 2) return false;
+
+    std::vector<Animation*> activeAnimations;
+    activeAnimations.reserve(animations.size());
+    for (auto& animation : animations) activeAnimations.push_back(animation.get());
+
+    // group animations that write to, or read from, the same targets, animations with samplers of unknown type are all placed in one group
+    const size_t numAnimations = activeAnimations.size();
+    const size_t unknownGroup = numAnimations;
+    std::vector<size_t> parents(numAnimations + 1);
+    for (size_t i = 0; i <= numAnimations; ++i) parents[i] = i;
+
+    std::map<const Object*, size_t> targetOwners;
+    std::vector<const Object*> targets;
+    std::vector<const Node*> transforms;
+    for (size_t i = 0; i < numAnimations; ++i)
+    {
+        for (auto& sampler : activeAnimations[i]->samplers)
+        {
+            if (!sampler) continue;
+
+            targets.clear();
+            if (!collectTargets(*sampler, targets, transforms))
+            {
+                parents[findRoot(parents, i)] = findRoot(parents, unknownGroup);
+                continue;
+            }
+
+            for (auto target : targets)
+            {
+                if (!target) continue;
+
+                auto [itr, inserted] = targetOwners.emplace(target, i);
+                if (!inserted) parents[findRoot(parents, i)] = findRoot(parents, itr->second);
+            }
+        }
+    }
+
+    // assign groups to tasks in order of first appearance, keeping list order within each group
+    size_t numTasks = std::min(numAnimations, operationThreads->threads.size() + 1);
+    std::vector<size_t> groupTasks(numAnimations + 1, numTasks);
+    std::vector<std::vector<size_t>> tasks(numTasks);
+    size_t nextTask = 0;
+    for (size_t i = 0; i < numAnimations; ++i)
+    {
+        size_t root = findRoot(parents, i);
+        if (groupTasks[root] == numTasks)
+        {
+            groupTasks[root] = nextTask;
+            nextTask = (nextTask + 1) % numTasks;
+        }
+        tasks[groupTasks[root]].push_back(i);
+    }
+
+    // all animations share targets so there is nothing to run in parallel
+    if (tasks[1].empty()) return false;
+
+    std::vector<uint8_t> stillActive(numAnimations, 0);
+
+    struct UpdateOperation : public Operation
+    {
+        UpdateOperation(AnimationManager* am, const std::vector<Animation*>& a, const std::vector<size_t>& i, std::vector<uint8_t>& r, ref_ptr<Latch> l) :
+            animationManager(am),
+            animations(a),
+            indices(i),
+            results(r),
+            latch(l) {}
+
+        void run() override
+        {
+            for (auto index : indices)
+            {
+                results[index] = animationManager->update(*animations[index]) ? 1 : 0;
+            }
+            latch->count_down();
+        }
+
+        AnimationManager* animationManager;
+        const std::vector<Animation*>& animations;
+        const std::vector<size_t>& indices;
+        std::vector<uint8_t>& results;
+        ref_ptr<Latch> latch;
+    };
+
+    size_t numActiveTasks = 0;
+    for (auto& task : tasks)
+    {
+        if (!task.empty()) ++numActiveTasks;
+    }
+
+    // use latch to synchronize this thread with the update threads
+    auto latch = Latch::create(static_cast<int>(numActiveTasks));
+    for (auto& task : tasks)
+    {
+        if (!task.empty()) operationThreads->add(ref_ptr<Operation>(new UpdateOperation(this, activeAnimations, task, stillActive, latch)));
+    }
+
+    // use this thread to process updates as well
+    operationThreads->run();
+
+    // wait till all the updates have completed
+    latch->wait();
+
+    // remove finished animations in list order so the result is independent of thread scheduling
+    size_t index = 0;
+    for (auto itr = animations.begin(); itr != animations.end(); ++index)
+    {
+        if (stillActive[index])
             ++itr;
         else
-        {
             itr = animations.erase(itr);
-        }
     }
+
+    return true;
 }
@@ -29,6 +29,15 @@ CameraKeyframes::CameraKeyframes()
 {
 }
 
+void CameraKeyframes::reduce(double positionTolerance, double rotationTolerance, double fieldOfViewTolerance)
+{
+    reduce_keyframes(origins, positionTolerance);
+    reduce_keyframes(positions, positionTolerance);
+    reduce_keyframes(rotations, rotationTolerance);
+    reduce_keyframes(fieldOfViews, fieldOfViewTolerance);
+    reduce_keyframes(nearFars, positionTolerance);
+}
+
 void CameraKeyframes::read(Input& input)
 {
     Object::read(input);
@@ -52,15 +52,53 @@ void JointSampler::update(double)
 {
     if (!jointMatrices) return;
 
-    _matrixStack.clear();
-    _matrixStack.push_back(dmat4());
+    // jointMatrices may share storage with other clones when loaded with Options::copyOnWriteDynamicData
+    jointMatrices->ensureUniqueStorage();
+
+    if (subgraph != _flattenedSubgraph) flattenSubgraph();
+
+    // accumulate the transforms in traversal order, each parent's global matrix is computed before its children
+    const dmat4 identity;
+    const size_t numTransforms = _flattenedTransforms.size();
+    _globalMatrices.resize(numTransforms);
+    for (size_t i = 0; i < numTransforms; ++i)
+    {
+        const auto& ft = _flattenedTransforms[i];
+        const dmat4& parentMatrix = (ft.parent >= 0) ? _globalMatrices[ft.parent] : identity;
+        auto& matrix = _globalMatrices[i];
+        if (ft.matrix)
+            matrix = parentMatrix * (*ft.matrix);
+        else
+            matrix = static_cast<const Transform*>(ft.node.get())->transform(parentMatrix);
+
+        if (ft.jointIndex >= 0)
+        {
+            jointMatrices->set(ft.jointIndex, mat4(matrix * offsetMatrices[ft.jointIndex]));
+        }
+    }
+
+    jointMatrices->dirty();
+}
+
+void JointSampler::flattenSubgraph()
+{
+    _flattenedTransforms.clear();
+    _parentStack.clear();
+    _parentStack.push_back(-1);
 
     if (subgraph)
     {
         subgraph->accept(*this);
     }
 
-    jointMatrices->dirty();
+    _flattenedSubgraph = subgraph;
+}
+
+void JointSampler::getTransforms(std::vector<const Node*>& transforms)
+{
+    if (subgraph != _flattenedSubgraph) flattenSubgraph();
+
+    for (auto& ft : _flattenedTransforms) transforms.push_back(ft.node.get());
 }
 
 double JointSampler::maxTime() const
@@ -94,11 +132,12 @@ void JointSampler::apply(Transform& transform)
 {
     if (!transform.children.empty())
     {
-        _matrixStack.push_back(transform.transform(_matrixStack.back()));
+        _parentStack.push_back(static_cast<int32_t>(_flattenedTransforms.size()));
+        _flattenedTransforms.push_back(FlattenedTransform{ref_ptr<Node>(&transform), nullptr, _parentStack[_parentStack.size() - 2], -1});
 
         transform.traverse(*this);
 
-        _matrixStack.pop_back();
+        _parentStack.pop_back();
     }
 }
 
@@ -106,29 +145,24 @@ void JointSampler::apply(MatrixTransform& mt)
 {
     if (!mt.children.empty())
     {
-        _matrixStack.push_back(_matrixStack.back() * mt.matrix);
+        _parentStack.push_back(static_cast<int32_t>(_flattenedTransforms.size()));
+        _flattenedTransforms.push_back(FlattenedTransform{ref_ptr<Node>(&mt), &mt.matrix, _parentStack[_parentStack.size() - 2], -1});
 
         mt.traverse(*this);
 
-        _matrixStack.pop_back();
+        _parentStack.pop_back();
     }
 }
 
 void JointSampler::apply(Joint& joint)
 {
-    auto matrix = _matrixStack.back() * joint.matrix;
-    jointMatrices->set(joint.index, mat4(matrix * offsetMatrices[joint.index]));
+    _parentStack.push_back(static_cast<int32_t>(_flattenedTransforms.size()));
+    _flattenedTransforms.push_back(FlattenedTransform{ref_ptr<Node>(&joint), &joint.matrix, _parentStack[_parentStack.size() - 2], static_cast<int32_t>(joint.index)});
 
-    if (!joint.children.empty())
+    for (auto& child : joint.children)
     {
-        _matrixStack.push_back(matrix);
-
-        for (auto& child : joint.children)
-        {
-            // apply(*child);
-            child->accept(*this);
-        }
-
-        _matrixStack.pop_back();
+        child->accept(*this);
     }
+
+    _parentStack.pop_back();
 }
@@ -13,7 +13,6 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/animation/MorphSampler.h>
 #include <vsg/core/compare.h>
 #include <vsg/io/Input.h>
-#include <vsg/io/Logger.h>
 #include <vsg/io/Output.h>
 
 using namespace vsg;
@@ -59,6 +58,85 @@ void MorphKeyframes::write(Output& output) const
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// MorphTarget
+//
+MorphTarget::MorphTarget()
+{
+}
+
+MorphTarget::MorphTarget(const MorphTarget& rhs, const CopyOp& copyop) :
+    Inherit(rhs, copyop),
+    indices(copyop(rhs.indices)),
+    vertexDeltas(copyop(rhs.vertexDeltas)),
+    normalDeltas(copyop(rhs.normalDeltas))
+{
+}
+
+int MorphTarget::compare(const Object& rhs_object) const
+{
+    int result = Object::compare(rhs_object);
+    if (result != 0) return result;
+
+    const auto& rhs = static_cast<decltype(*this)>(rhs_object);
+    if ((result = compare_pointer(indices, rhs.indices)) != 0) return result;
+    if ((result = compare_pointer(vertexDeltas, rhs.vertexDeltas)) != 0) return result;
+    return compare_pointer(normalDeltas, rhs.normalDeltas);
+}
+
+void MorphTarget::assignDeltas(const vec3Array* denseVertexDeltas, const vec3Array* denseNormalDeltas, float epsilon)
+{
+    auto moved = [epsilon](const vec3& delta) {
+        return std::abs(delta.x) > epsilon || std::abs(delta.y) > epsilon || std::abs(delta.z) > epsilon;
+    };
+
+    size_t numVertices = std::max(denseVertexDeltas ? denseVertexDeltas->size() : 0, denseNormalDeltas ? denseNormalDeltas->size() : 0);
+
+    std::vector<uint32_t> movedIndices;
+    for (size_t i = 0; i < numVertices; ++i)
+    {
+        if ((denseVertexDeltas && i < denseVertexDeltas->size() && moved(denseVertexDeltas->at(i))) ||
+            (denseNormalDeltas && i < denseNormalDeltas->size() && moved(denseNormalDeltas->at(i))))
+        {
+            movedIndices.push_back(static_cast<uint32_t>(i));
+        }
+    }
+
+    auto sparseDeltas = [&](const vec3Array* dense) -> ref_ptr<vec3Array> {
+        if (!dense) return {};
+        auto sparse = vec3Array::create(static_cast<uint32_t>(movedIndices.size()));
+        for (size_t i = 0; i < movedIndices.size(); ++i)
+        {
+            sparse->set(i, (movedIndices[i] < dense->size()) ? dense->at(movedIndices[i]) : vec3());
+        }
+        return sparse;
+    };
+
+    indices = uintArray::create(static_cast<uint32_t>(movedIndices.size()));
+    std::copy(movedIndices.begin(), movedIndices.end(), indices->begin());
+    vertexDeltas = sparseDeltas(denseVertexDeltas);
+    normalDeltas = sparseDeltas(denseNormalDeltas);
+}
+
+void MorphTarget::read(Input& input)
+{
+    Object::read(input);
+
+    input.read("indices", indices);
+    input.read("vertexDeltas", vertexDeltas);
+    input.read("normalDeltas", normalDeltas);
+}
+
+void MorphTarget::write(Output& output) const
+{
+    Object::write(output);
+
+    output.write("indices", indices);
+    output.write("vertexDeltas", vertexDeltas);
+    output.write("normalDeltas", normalDeltas);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // MorphSampler
@@ -70,7 +148,13 @@ MorphSampler::MorphSampler()
 MorphSampler::MorphSampler(const MorphSampler& rhs, const CopyOp& copyop) :
     Inherit(rhs, copyop),
     keyframes(copyop(rhs.keyframes)),
-    object(copyop(rhs.object))
+    object(copyop(rhs.object)),
+    targets(copyop(rhs.targets)),
+    baseVertices(copyop(rhs.baseVertices)),
+    baseNormals(copyop(rhs.baseNormals)),
+    vertices(copyop(rhs.vertices)),
+    normals(copyop(rhs.normals)),
+    weights(copyop(rhs.weights))
 {
 }
 
@@ -81,13 +165,147 @@ int MorphSampler::compare(const Object& rhs_object) const
 
     const auto& rhs = static_cast<decltype(*this)>(rhs_object);
     if ((result = compare_pointer(keyframes, rhs.keyframes)) != 0) return result;
-    return compare_pointer(object, rhs.object);
+    if ((result = compare_pointer(object, rhs.object)) != 0) return result;
+    if ((result = compare_pointer_container(targets, rhs.targets)) != 0) return result;
+    if ((result = compare_pointer(baseVertices, rhs.baseVertices)) != 0) return result;
+    if ((result = compare_pointer(baseNormals, rhs.baseNormals)) != 0) return result;
+    if ((result = compare_pointer(vertices, rhs.vertices)) != 0) return result;
+    if ((result = compare_pointer(normals, rhs.normals)) != 0) return result;
+    return compare_pointer(weights, rhs.weights);
+}
+
+void MorphSampler::update(double time)
+{
+    if (!keyframes || keyframes->keyframes.empty()) return;
+
+    size_t numWeights = targets.size();
+    if (weights) numWeights = std::max(numWeights, static_cast<size_t>(weights->size()));
+
+    _weights.assign(numWeights, 0.0f);
+    _previousWeights.resize(numWeights, 0.0f);
+
+    auto accumulate = [&](const MorphKey& key, double scale) {
+        size_t numValues = std::min(key.values.size(), key.weights.size());
+        for (size_t i = 0; i < numValues; ++i)
+        {
+            if (key.values[i] < numWeights) _weights[key.values[i]] += static_cast<float>(key.weights[i] * scale);
+        }
+    };
+
+    // interpolate the weights between the keyframes either side of time
+    const auto& keys = keyframes->keyframes;
+    if (time <= keys.front().time)
+    {
+        accumulate(keys.front(), 1.0);
+    }
+    else if (time >= keys.back().time)
+    {
+        accumulate(keys.back(), 1.0);
+    }
+    else
+    {
+        auto after_itr = std::lower_bound(keys.begin(), keys.end(), time, [](const MorphKey& key, double t) { return key.time < t; });
+        const auto& before = *(after_itr - 1);
+        const auto& after = *after_itr;
+        double delta_time = after.time - before.time;
+        double r = delta_time != 0.0 ? (time - before.time) / delta_time : 1.0;
+        accumulate(before, 1.0 - r);
+        accumulate(after, r);
+    }
+
+    if (weights)
+    {
+        bool modified = false;
+        for (size_t i = 0; i < weights->size(); ++i)
+        {
+            if (weights->at(i) != _weights[i])
+            {
+                // weights may share storage with other clones when loaded with Options::copyOnWriteDynamicData
+                if (!modified) weights->ensureUniqueStorage();
+                weights->set(i, _weights[i]);
+                modified = true;
+            }
+        }
+        if (modified) weights->dirty();
+    }
+
+    bool weightsChanged = (_weights != _previousWeights);
+
+    if (vertices && baseVertices && vertices != baseVertices)
+    {
+        bool reassigned = (_blendedVertices != vertices.get());
+        if (reassigned || weightsChanged)
+        {
+            // vertices may also share storage with other clones
+            vertices->ensureUniqueStorage();
+            if (reassigned)
+            {
+                uint32_t numValues = std::min(baseVertices->size(), vertices->size());
+                for (uint32_t i = 0; i < numValues; ++i) vertices->at(i) = baseVertices->at(i);
+                _blendedVertices = vertices.get();
+            }
+            blend(*vertices, *baseVertices, false);
+        }
+    }
+
+    if (normals && baseNormals && normals != baseNormals)
+    {
+        bool reassigned = (_blendedNormals != normals.get());
+        if (reassigned || weightsChanged)
+        {
+            normals->ensureUniqueStorage();
+            if (reassigned)
+            {
+                uint32_t numValues = std::min(baseNormals->size(), normals->size());
+                for (uint32_t i = 0; i < numValues; ++i) normals->at(i) = baseNormals->at(i);
+                _blendedNormals = normals.get();
+            }
+            blend(*normals, *baseNormals, true);
+        }
+    }
+
+    _previousWeights.swap(_weights);
 }
 
-void MorphSampler::update(double /*time*/)
+void MorphSampler::blend(vec3Array& destination, const vec3Array& base, bool blendNormals)
 {
-    // TODO write implementation of passing morph values to associated scene graph data structures
-    vsg::warn("MorphSampler::update(double time) not implemented yet");
+    const uint32_t numVertices = std::min(destination.size(), base.size());
+    const size_t numTargets = std::min(targets.size(), _weights.size());
+
+    // reset the vertices moved by the previously or currently active targets back to their base values
+    for (size_t t = 0; t < numTargets; ++t)
+    {
+        if (_weights[t] == 0.0f && _previousWeights[t] == 0.0f) continue;
+
+        const auto* target = targets[t].get();
+        if (!target || !target->indices) continue;
+
+        for (auto index : *(target->indices))
+        {
+            if (index < numVertices) destination[index] = base[index];
+        }
+    }
+
+    // accumulate the weighted sparse deltas of the active targets
+    for (size_t t = 0; t < numTargets; ++t)
+    {
+        const float weight = _weights[t];
+        if (weight == 0.0f) continue;
+
+        const auto* target = targets[t].get();
+        const auto* deltas = target ? (blendNormals ? target->normalDeltas.get() : target->vertexDeltas.get()) : nullptr;
+        if (!deltas || !target->indices) continue;
+
+        const auto& indices = *(target->indices);
+        const uint32_t numDeltas = std::min(indices.size(), deltas->size());
+        for (uint32_t i = 0; i < numDeltas; ++i)
+        {
+            uint32_t index = indices[i];
+            if (index < numVertices) destination[index] += deltas->at(i) * weight;
+        }
+    }
+
+    destination.dirty();
 }
 
 double MorphSampler::maxTime() const
@@ -105,6 +323,16 @@ void MorphSampler::read(Input& input)
     AnimationSampler::read(input);
     input.read("keyframes", keyframes);
     input.read("object", object);
+
+    if (input.version_greater_equal(1, 1, 12))
+    {
+        input.readObjects("targets", targets);
+        input.read("baseVertices", baseVertices);
+        input.read("baseNormals", baseNormals);
+        input.read("vertices", vertices);
+        input.read("normals", normals);
+        input.read("weights", weights);
+    }
 }
 
 void MorphSampler::write(Output& output) const
@@ -112,4 +340,14 @@ void MorphSampler::write(Output& output) const
     AnimationSampler::write(output);
     output.write("keyframes", keyframes);
     output.write("object", object);
+
+    if (output.version_greater_equal(1, 1, 12))
+    {
+        output.writeObjects("targets", targets);
+        output.write("baseVertices", baseVertices);
+        output.write("baseNormals", baseNormals);
+        output.write("vertices", vertices);
+        output.write("normals", normals);
+        output.write("weights", weights);
+    }
 }
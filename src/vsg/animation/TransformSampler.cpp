@@ -103,6 +103,307 @@ void TransformKeyframes::write(Output& output) const
     }
 }
 
+void TransformKeyframes::reduce(double positionTolerance, double rotationTolerance, double scaleTolerance)
+{
+    reduce_keyframes(positions, positionTolerance);
+    reduce_keyframes(rotations, rotationTolerance);
+    reduce_keyframes(scales, scaleTolerance);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// CompressedTransformKeyframes
+//
+namespace
+{
+    const double rotationQuantization = 32767.0;
+
+    // quantize a vector channel to 16 bits per component across its range and remove the keyframes that can be interpolated to within tolerance
+    void compressVectors(const std::vector<VectorKey>& keys, double tolerance, ref_ptr<floatArray>& times, ref_ptr<usvec3Array>& values, dvec3& origin, dvec3& scale)
+    {
+        times = {};
+        values = {};
+        origin.set(0.0, 0.0, 0.0);
+        scale.set(0.0, 0.0, 0.0);
+        if (keys.empty()) return;
+
+        dvec3 minValue = keys.front().value;
+        dvec3 maxValue = keys.front().value;
+        for (const auto& key : keys)
+        {
+            for (size_t c = 0; c < 3; ++c)
+            {
+                minValue[c] = std::min(minValue[c], key.value[c]);
+                maxValue[c] = std::max(maxValue[c], key.value[c]);
+            }
+        }
+
+        origin = minValue;
+        scale = (maxValue - minValue) / 65535.0;
+
+        auto quantize = [&](const dvec3& v) {
+            usvec3 q;
+            for (size_t c = 0; c < 3; ++c) q[c] = scale[c] > 0.0 ? static_cast<uint16_t>(std::round((v[c] - origin[c]) / scale[c])) : 0;
+            return q;
+        };
+
+        std::vector<usvec3> quantizedValues;
+        std::vector<VectorKey> decoded;
+        quantizedValues.reserve(keys.size());
+        decoded.reserve(keys.size());
+        for (const auto& key : keys)
+        {
+            quantizedValues.push_back(quantize(key.value));
+            decoded.push_back(VectorKey{static_cast<float>(key.time), origin + dvec3(quantizedValues.back()) * scale});
+        }
+
+        auto indices = select_keyframes(decoded, keys, tolerance);
+
+        times = floatArray::create(static_cast<uint32_t>(indices.size()));
+        values = usvec3Array::create(static_cast<uint32_t>(indices.size()));
+        for (size_t i = 0; i < indices.size(); ++i)
+        {
+            times->set(i, static_cast<float>(keys[indices[i]].time));
+            values->set(i, quantizedValues[indices[i]]);
+        }
+    }
+
+    dquat decodeRotation(const svec4& q)
+    {
+        return normalize(dquat(q.x / rotationQuantization, q.y / rotationQuantization, q.z / rotationQuantization, q.w / rotationQuantization));
+    }
+
+    void compressRotations(const std::vector<QuatKey>& keys, double tolerance, ref_ptr<floatArray>& times, ref_ptr<svec4Array>& values)
+    {
+        times = {};
+        values = {};
+        if (keys.empty()) return;
+
+        auto quantize = [](const dquat& q) {
+            auto nq = normalize(q);
+            return svec4(static_cast<int16_t>(std::round(nq.x * rotationQuantization)),
+                         static_cast<int16_t>(std::round(nq.y * rotationQuantization)),
+                         static_cast<int16_t>(std::round(nq.z * rotationQuantization)),
+                         static_cast<int16_t>(std::round(nq.w * rotationQuantization)));
+        };
+
+        std::vector<svec4> quantizedValues;
+        std::vector<QuatKey> decoded;
+        quantizedValues.reserve(keys.size());
+        decoded.reserve(keys.size());
+        for (const auto& key : keys)
+        {
+            quantizedValues.push_back(quantize(key.value));
+            decoded.push_back(QuatKey{static_cast<float>(key.time), decodeRotation(quantizedValues.back())});
+        }
+
+        auto indices = select_keyframes(decoded, keys, tolerance);
+
+        times = floatArray::create(static_cast<uint32_t>(indices.size()));
+        values = svec4Array::create(static_cast<uint32_t>(indices.size()));
+        for (size_t i = 0; i < indices.size(); ++i)
+        {
+            times->set(i, static_cast<float>(keys[indices[i]].time));
+            values->set(i, quantizedValues[indices[i]]);
+        }
+    }
+
+    // set cursor to the index of the keyframe interval where times[cursor] < time <= times[cursor+1], returns false if time is outside the keyframe times, in which case cursor is set to the nearest end.
+    bool findInterval(const floatArray& times, double time, size_t& cursor)
+    {
+        size_t size = times.size();
+        if (size == 1 || time <= times[0])
+        {
+            cursor = 0;
+            return false;
+        }
+
+        if (time > times[size - 1])
+        {
+            cursor = size - 1;
+            return false;
+        }
+
+        size_t lower = 0;
+        if (cursor < size - 1 && times[cursor] < time)
+        {
+            // step forward a few keyframes before falling back to a binary search for larger jumps
+            for (int i = 0; i < 4; ++i)
+            {
+                if (time <= times[cursor + 1]) return true;
+                ++cursor;
+            }
+            lower = cursor;
+        }
+
+        // binary search for the first keyframe with times[upper] >= time
+        size_t upper = size - 1;
+        while (lower + 1 < upper)
+        {
+            size_t middle = (lower + upper) / 2;
+            if (times[middle] < time)
+                lower = middle;
+            else
+                upper = middle;
+        }
+        cursor = lower;
+        return true;
+    }
+
+    template<typename V, class D>
+    bool sampleCompressed(double time, const floatArray* times, V& value, size_t& cursor, D decode)
+    {
+        if (!times || times->size() == 0) return false;
+
+        if (!findInterval(*times, time, cursor))
+        {
+            value = decode(cursor);
+            return true;
+        }
+
+        double before_time = times->at(cursor);
+        double delta_time = times->at(cursor + 1) - before_time;
+        double r = delta_time != 0.0 ? (time - before_time) / delta_time : 0.5;
+
+        value = mix(decode(cursor), decode(cursor + 1), r);
+
+        return true;
+    }
+} // namespace
+
+CompressedTransformKeyframes::CompressedTransformKeyframes()
+{
+}
+
+CompressedTransformKeyframes::CompressedTransformKeyframes(const CompressedTransformKeyframes& rhs, const CopyOp& copyop) :
+    Inherit(rhs, copyop),
+    name(rhs.name),
+    positionTimes(copyop(rhs.positionTimes)),
+    positions(copyop(rhs.positions)),
+    positionOrigin(rhs.positionOrigin),
+    positionScale(rhs.positionScale),
+    rotationTimes(copyop(rhs.rotationTimes)),
+    rotations(copyop(rhs.rotations)),
+    scaleTimes(copyop(rhs.scaleTimes)),
+    scales(copyop(rhs.scales)),
+    scaleOrigin(rhs.scaleOrigin),
+    scaleScale(rhs.scaleScale)
+{
+}
+
+CompressedTransformKeyframes::CompressedTransformKeyframes(const TransformKeyframes& keyframes, double positionTolerance, double rotationTolerance, double scaleTolerance) :
+    name(keyframes.name)
+{
+    compressVectors(keyframes.positions, positionTolerance, positionTimes, positions, positionOrigin, positionScale);
+    compressRotations(keyframes.rotations, rotationTolerance, rotationTimes, rotations);
+    compressVectors(keyframes.scales, scaleTolerance, scaleTimes, scales, scaleOrigin, scaleScale);
+}
+
+dquat CompressedTransformKeyframes::rotation(size_t i) const
+{
+    return decodeRotation(rotations->at(i));
+}
+
+bool CompressedTransformKeyframes::samplePosition(double time, dvec3& value, size_t& cursor) const
+{
+    return positions && sampleCompressed(time, positionTimes, value, cursor, [this](size_t i) { return position(i); });
+}
+
+bool CompressedTransformKeyframes::sampleRotation(double time, dquat& value, size_t& cursor) const
+{
+    return rotations && sampleCompressed(time, rotationTimes, value, cursor, [this](size_t i) { return rotation(i); });
+}
+
+bool CompressedTransformKeyframes::sampleScale(double time, dvec3& value, size_t& cursor) const
+{
+    return scales && sampleCompressed(time, scaleTimes, value, cursor, [this](size_t i) { return scale(i); });
+}
+
+double CompressedTransformKeyframes::maxTime() const
+{
+    double maxTime = 0.0;
+    if (positionTimes && positionTimes->size() > 0) maxTime = std::max(maxTime, static_cast<double>(positionTimes->at(positionTimes->size() - 1)));
+    if (rotationTimes && rotationTimes->size() > 0) maxTime = std::max(maxTime, static_cast<double>(rotationTimes->at(rotationTimes->size() - 1)));
+    if (scaleTimes && scaleTimes->size() > 0) maxTime = std::max(maxTime, static_cast<double>(scaleTimes->at(scaleTimes->size() - 1)));
+    return maxTime;
+}
+
+ref_ptr<TransformKeyframes> CompressedTransformKeyframes::decompress() const
+{
+    auto keyframes = TransformKeyframes::create();
+    keyframes->name = name;
+
+    if (positionTimes && positions)
+    {
+        for (size_t i = 0; i < std::min(positionTimes->size(), positions->size()); ++i) keyframes->positions.push_back(VectorKey{positionTimes->at(i), position(i)});
+    }
+
+    if (rotationTimes && rotations)
+    {
+        for (size_t i = 0; i < std::min(rotationTimes->size(), rotations->size()); ++i) keyframes->rotations.push_back(QuatKey{rotationTimes->at(i), rotation(i)});
+    }
+
+    if (scaleTimes && scales)
+    {
+        for (size_t i = 0; i < std::min(scaleTimes->size(), scales->size()); ++i) keyframes->scales.push_back(VectorKey{scaleTimes->at(i), scale(i)});
+    }
+
+    return keyframes;
+}
+
+int CompressedTransformKeyframes::compare(const Object& rhs_object) const
+{
+    int result = Object::compare(rhs_object);
+    if (result != 0) return result;
+
+    const auto& rhs = static_cast<decltype(*this)>(rhs_object);
+    if ((result = compare_value(name, rhs.name)) != 0) return result;
+    if ((result = compare_pointer(positionTimes, rhs.positionTimes)) != 0) return result;
+    if ((result = compare_pointer(positions, rhs.positions)) != 0) return result;
+    if ((result = compare_value(positionOrigin, rhs.positionOrigin)) != 0) return result;
+    if ((result = compare_value(positionScale, rhs.positionScale)) != 0) return result;
+    if ((result = compare_pointer(rotationTimes, rhs.rotationTimes)) != 0) return result;
+    if ((result = compare_pointer(rotations, rhs.rotations)) != 0) return result;
+    if ((result = compare_pointer(scaleTimes, rhs.scaleTimes)) != 0) return result;
+    if ((result = compare_pointer(scales, rhs.scales)) != 0) return result;
+    if ((result = compare_value(scaleOrigin, rhs.scaleOrigin)) != 0) return result;
+    return compare_value(scaleScale, rhs.scaleScale);
+}
+
+void CompressedTransformKeyframes::read(Input& input)
+{
+    Object::read(input);
+
+    input.read("name", name);
+    input.read("positionTimes", positionTimes);
+    input.read("positions", positions);
+    input.read("positionOrigin", positionOrigin);
+    input.read("positionScale", positionScale);
+    input.read("rotationTimes", rotationTimes);
+    input.read("rotations", rotations);
+    input.read("scaleTimes", scaleTimes);
+    input.read("scales", scales);
+    input.read("scaleOrigin", scaleOrigin);
+    input.read("scaleScale", scaleScale);
+}
+
+void CompressedTransformKeyframes::write(Output& output) const
+{
+    Object::write(output);
+
+    output.write("name", name);
+    output.write("positionTimes", positionTimes);
+    output.write("positions", positions);
+    output.write("positionOrigin", positionOrigin);
+    output.write("positionScale", positionScale);
+    output.write("rotationTimes", rotationTimes);
+    output.write("rotations", rotations);
+    output.write("scaleTimes", scaleTimes);
+    output.write("scales", scales);
+    output.write("scaleOrigin", scaleOrigin);
+    output.write("scaleScale", scaleScale);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // TransformSampler
@@ -117,6 +418,7 @@ TransformSampler::TransformSampler() :
 TransformSampler::TransformSampler(const TransformSampler& rhs, const CopyOp& copyop) :
     Inherit(rhs, copyop),
     keyframes(copyop(rhs.keyframes)),
+    compressedKeyframes(copyop(rhs.compressedKeyframes)),
     object(copyop(rhs.object)),
     position(rhs.position),
     rotation(rhs.rotation),
@@ -131,6 +433,7 @@ int TransformSampler::compare(const Object& rhs_object) const
 
     const auto& rhs = static_cast<decltype(*this)>(rhs_object);
     if ((result = compare_pointer(keyframes, rhs.keyframes)) != 0) return result;
+    if ((result = compare_pointer(compressedKeyframes, rhs.compressedKeyframes)) != 0) return result;
     return compare_pointer(object, rhs.object);
 }
 
@@ -138,9 +441,15 @@ void TransformSampler::update(double time)
 {
     if (keyframes)
     {
-        sample(time, keyframes->positions, position);
-        sample(time, keyframes->rotations, rotation);
-        sample(time, keyframes->scales, scale);
+        sample(time, keyframes->positions, position, _positionCursor);
+        sample(time, keyframes->rotations, rotation, _rotationCursor);
+        sample(time, keyframes->scales, scale, _scaleCursor);
+    }
+    else if (compressedKeyframes)
+    {
+        compressedKeyframes->samplePosition(time, position, _positionCursor);
+        compressedKeyframes->sampleRotation(time, rotation, _rotationCursor);
+        compressedKeyframes->sampleScale(time, scale, _scaleCursor);
     }
 
     if (object) object->accept(*this);
@@ -155,6 +464,10 @@ double TransformSampler::maxTime() const
         if (!keyframes->rotations.empty()) maxTime = std::max(maxTime, keyframes->rotations.back().time);
         if (!keyframes->scales.empty()) maxTime = std::max(maxTime, keyframes->scales.back().time);
     }
+    else if (compressedKeyframes)
+    {
+        maxTime = compressedKeyframes->maxTime();
+    }
 
     return maxTime;
 }
@@ -196,6 +509,7 @@ void TransformSampler::read(Input& input)
 {
     AnimationSampler::read(input);
     input.read("keyframes", keyframes);
+    if (input.version_greater_equal(1, 1, 12)) input.read("compressedKeyframes", compressedKeyframes);
     input.read("object", object);
 }
 
@@ -203,5 +517,6 @@ void TransformSampler::write(Output& output) const
 {
     AnimationSampler::write(output);
     output.write("keyframes", keyframes);
+    if (output.version_greater_equal(1, 1, 12)) output.write("compressedKeyframes", compressedKeyframes);
     output.write("object", object);
 }
@@ -91,6 +91,8 @@ void CommandGraph::record(ref_ptr<RecordedCommandBuffers> recordedCommandBuffers
     recordTraversal->setDatabasePager(databasePager);
     recordTraversal->clearBins();
     recordTraversal->regionsOfInterest.clear();
+    recordTraversal->numDrawsTested = 0;
+    recordTraversal->numDrawsCulled = 0;
 
     ref_ptr<CommandBuffer> commandBuffer;
     for (auto& cb : _commandBuffers)
@@ -0,0 +1,368 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/MultiFrustumCull.h>
+#include <vsg/app/RecordTraversal.h>
+#include <vsg/io/Logger.h>
+#include <vsg/nodes/CoordinateFrame.h>
+#include <vsg/nodes/CullGroup.h>
+#include <vsg/nodes/CullNode.h>
+#include <vsg/nodes/DepthSorted.h>
+#include <vsg/nodes/LOD.h>
+#include <vsg/nodes/Layer.h>
+#include <vsg/nodes/PagedLOD.h>
+#include <vsg/nodes/QuadGroup.h>
+#include <vsg/nodes/StateGroup.h>
+#include <vsg/nodes/Switch.h>
+#include <vsg/nodes/Transform.h>
+
+#include <algorithm>
+
+using namespace vsg;
+
+/////////////////////////////////////////////////////////////////////////
+//
+// DrawList
+//
+DrawList::DrawList()
+{
+}
+
+DrawList::~DrawList()
+{
+}
+
+void DrawList::clear()
+{
+    matrices.clear();
+    stateCommands.clear();
+    elements.clear();
+}
+
+void DrawList::add(const dmat4& matrix, const std::vector<const StateCommand*>& stateStack, const Node* node)
+{
+    Element element;
+    element.child = node;
+
+    if (matrices.empty() || matrices.back() != matrix)
+    {
+        matrices.push_back(matrix);
+    }
+    element.matrixIndex = static_cast<uint32_t>(matrices.size()) - 1;
+
+    // siblings typically share the same state so reuse the previous element's state commands when they match
+    if (!elements.empty())
+    {
+        const auto& previous = elements.back();
+        if (previous.stateCommandCount == stateStack.size() && std::equal(stateStack.begin(), stateStack.end(), stateCommands.begin() + previous.stateCommandIndex))
+        {
+            element.stateCommandIndex = previous.stateCommandIndex;
+            element.stateCommandCount = previous.stateCommandCount;
+            elements.push_back(element);
+            return;
+        }
+    }
+
+    element.stateCommandIndex = static_cast<uint32_t>(stateCommands.size());
+    element.stateCommandCount = static_cast<uint32_t>(stateStack.size());
+    stateCommands.insert(stateCommands.end(), stateStack.begin(), stateStack.end());
+
+    elements.push_back(element);
+}
+
+void DrawList::traverse(RecordTraversal& rt) const
+{
+    auto state = rt.getState();
+
+    // the model matrices are relative to the world so combine them with the view matrix of the View being recorded
+    dmat4 viewMatrix = state->modelviewMatrixStack.top();
+    uint32_t previousMatrixIndex = static_cast<uint32_t>(matrices.size());
+
+    state->pushFrustum();
+
+    for (const auto& element : elements)
+    {
+        if (element.matrixIndex != previousMatrixIndex)
+        {
+            if (previousMatrixIndex != matrices.size()) state->modelviewMatrixStack.pop();
+
+            state->modelviewMatrixStack.push(viewMatrix * matrices[element.matrixIndex]);
+            state->applyFrustum();
+            state->dirty = true;
+            previousMatrixIndex = element.matrixIndex;
+        }
+
+        if (element.stateCommandCount > 0)
+        {
+            auto begin = stateCommands.begin() + element.stateCommandIndex;
+            auto end = begin + element.stateCommandCount;
+            state->push(begin, end);
+
+            element.child->accept(rt);
+
+            state->pop(begin, end);
+        }
+        else
+        {
+            element.child->accept(rt);
+        }
+    }
+
+    if (previousMatrixIndex != matrices.size()) state->modelviewMatrixStack.pop();
+
+    state->popFrustum();
+    state->dirty = true;
+}
+
+/////////////////////////////////////////////////////////////////////////
+//
+// MultiFrustumCull
+//
+MultiFrustumCull::MultiFrustumCull()
+{
+}
+
+void MultiFrustumCull::cull(const Node& node)
+{
+    if (views.size() > maxNumViews)
+    {
+        warn("MultiFrustumCull::cull() number of views ", views.size(), " exceeds maximum of ", maxNumViews, ", ignoring additional views.");
+        views.resize(maxNumViews);
+    }
+
+    for (auto& view : views)
+    {
+        if (!view.drawList)
+            view.drawList = DrawList::create();
+        else
+            view.drawList->clear();
+    }
+
+    // frusta in clip space transformed by each view's projection matrix, with the LOD frustum last
+    Frustum unitFrustum;
+    _projectedFrusta.clear();
+    for (auto& view : views)
+    {
+        _projectedFrusta.emplace_back(unitFrustum, view.projectionMatrix);
+    }
+    _projectedFrusta.emplace_back(unitFrustum, lodProjectionMatrix);
+
+    numFrustumTests = 0;
+    _mask = (views.size() == maxNumViews) ? ~0u : ((1u << views.size()) - 1u);
+    _matrixStack.clear();
+    _frustaStack.clear();
+    _stateStack.clear();
+
+    pushFrusta(dmat4());
+
+    node.accept(*this);
+
+    popFrusta();
+}
+
+void MultiFrustumCull::pushFrusta(const dmat4& matrix)
+{
+    _matrixStack.push_back(matrix);
+
+    auto& frusta = _frustaStack.emplace_back(_projectedFrusta.size());
+    for (size_t i = 0; i < views.size(); ++i)
+    {
+        frusta[i].set(_projectedFrusta[i], views[i].viewMatrix * matrix);
+    }
+
+    dmat4 lodModelView = lodViewMatrix * matrix;
+    frusta.back().set(_projectedFrusta.back(), lodModelView);
+    frusta.back().computeLodScale(lodProjectionMatrix, lodModelView);
+}
+
+void MultiFrustumCull::popFrusta()
+{
+    _frustaStack.pop_back();
+    _matrixStack.pop_back();
+}
+
+uint32_t MultiFrustumCull::intersect(const dsphere& bs)
+{
+    const auto& frusta = _frustaStack.back();
+
+    uint32_t mask = 0;
+    for (uint32_t i = 0, bit = 1; i < views.size(); ++i, bit <<= 1)
+    {
+        if ((_mask & bit) != 0)
+        {
+            ++numFrustumTests;
+            if (frusta[i].intersect(bs)) mask |= bit;
+        }
+    }
+    return mask;
+}
+
+double MultiFrustumCull::lodDistance(const dsphere& bs) const
+{
+    const auto& lodScale = _frustaStack.back().back().lodScale;
+    return std::abs(lodScale[0] * bs.x + lodScale[1] * bs.y + lodScale[2] * bs.z + lodScale[3]);
+}
+
+void MultiFrustumCull::apply(const Node& node)
+{
+    // leaf nodes and nodes without specific culling support are recorded as a whole by the RecordTraversal
+    const auto& matrix = _matrixStack.back();
+    for (uint32_t i = 0, bit = 1; i < views.size(); ++i, bit <<= 1)
+    {
+        if ((_mask & bit) != 0) views[i].drawList->add(matrix, _stateStack, &node);
+    }
+}
+
+void MultiFrustumCull::apply(const Group& group)
+{
+    group.traverse(*this);
+}
+
+void MultiFrustumCull::apply(const QuadGroup& quadGroup)
+{
+    quadGroup.traverse(*this);
+}
+
+void MultiFrustumCull::apply(const LOD& lod)
+{
+    const auto& sphere = lod.bound;
+
+    auto mask = intersect(sphere);
+    if (mask == 0) return;
+
+    // select the child using the LOD view, which may select a child even when the LOD view itself doesn't see the LOD
+    auto distance = lodDistance(sphere);
+    for (auto& child : lod.children)
+    {
+        auto cutoff = distance * child.minimumScreenHeightRatio;
+        if (sphere.r > cutoff)
+        {
+            auto cached_mask = _mask;
+            _mask = mask;
+
+            child.node->accept(*this);
+
+            _mask = cached_mask;
+            return;
+        }
+    }
+}
+
+void MultiFrustumCull::apply(const PagedLOD& plod)
+{
+    const auto& sphere = plod.bound;
+
+    auto mask = intersect(sphere);
+    if (mask == 0) return;
+
+    auto cached_mask = _mask;
+    _mask = mask;
+
+    // loading of high res children is left to the main view's RecordTraversal, so only use children that are already loaded
+    auto distance = lodDistance(sphere);
+    const auto& highRes = plod.children[0];
+    const auto& lowRes = plod.children[1];
+    if (highRes.node && sphere.r > distance * highRes.minimumScreenHeightRatio)
+    {
+        highRes.node->accept(*this);
+    }
+    else if (lowRes.node && sphere.r > distance * lowRes.minimumScreenHeightRatio)
+    {
+        lowRes.node->accept(*this);
+    }
+
+    _mask = cached_mask;
+}
+
+void MultiFrustumCull::apply(const CullGroup& cullGroup)
+{
+    auto mask = intersect(cullGroup.bound);
+    if (mask == 0) return;
+
+    auto cached_mask = _mask;
+    _mask = mask;
+
+    cullGroup.traverse(*this);
+
+    _mask = cached_mask;
+}
+
+void MultiFrustumCull::apply(const CullNode& cullNode)
+{
+    auto mask = intersect(cullNode.bound);
+    if (mask == 0) return;
+
+    auto cached_mask = _mask;
+    _mask = mask;
+
+    cullNode.traverse(*this);
+
+    _mask = cached_mask;
+}
+
+void MultiFrustumCull::apply(const DepthSorted& depthSorted)
+{
+    auto mask = intersect(depthSorted.bound);
+    if (mask == 0) return;
+
+    // the RecordTraversal assigns the DepthSorted to the appropriate Bin
+    auto cached_mask = _mask;
+    _mask = mask;
+
+    apply(static_cast<const Node&>(depthSorted));
+
+    _mask = cached_mask;
+}
+
+void MultiFrustumCull::apply(const Layer& layer)
+{
+    // the RecordTraversal assigns the Layer to the appropriate Bin
+    if ((traversalMask & (overrideMask | layer.mask)) != MASK_OFF)
+    {
+        apply(static_cast<const Node&>(layer));
+    }
+}
+
+void MultiFrustumCull::apply(const Switch& sw)
+{
+    for (auto& child : sw.children)
+    {
+        if ((traversalMask & (overrideMask | child.mask)) != MASK_OFF)
+        {
+            child.node->accept(*this);
+        }
+    }
+}
+
+void MultiFrustumCull::apply(const StateGroup& stateGroup)
+{
+    _stateStack.insert(_stateStack.end(), stateGroup.stateCommands.begin(), stateGroup.stateCommands.end());
+
+    stateGroup.traverse(*this);
+
+    _stateStack.resize(_stateStack.size() - stateGroup.stateCommands.size());
+}
+
+void MultiFrustumCull::apply(const Transform& transform)
+{
+    pushFrusta(transform.transform(_matrixStack.back()));
+
+    transform.traverse(*this);
+
+    popFrusta();
+}
+
+void MultiFrustumCull::apply(const CoordinateFrame& cf)
+{
+    // CoordinateFrame uses the view's origin to maintain precision, so leave it to the RecordTraversal to handle
+    apply(static_cast<const Node&>(cf));
+}
@@ -327,11 +327,25 @@ void RecordTraversal::apply(const Layer& layer)
     }
 }
 
+bool RecordTraversal::cullDraw(const DrawBound& drawBound, const BufferInfoList& arrays)
+{
+    auto bound = drawBound.get(arrays);
+    if (!bound.valid()) return false;
+
+    ++numDrawsTested;
+    if (_state->intersect(bound)) return false;
+
+    ++numDrawsCulled;
+    return true;
+}
+
 void RecordTraversal::apply(const VertexDraw& vd)
 {
     GPU_INSTRUMENTATION_L3_NCO(instrumentation, *getCommandBuffer(), "VertexDraw", COLOR_GPU, &vd);
 
     //debug("Visiting VertexDraw");
+    if (vd.drawBound.enabled && cullDraw(vd.drawBound, vd.arrays)) return;
+
     _state->record();
     vd.record(*(_state->_commandBuffer));
 }
@@ -341,6 +355,8 @@ void RecordTraversal::apply(const VertexIndexDraw& vid)
     GPU_INSTRUMENTATION_L3_NCO(instrumentation, *getCommandBuffer(), "VertexIndexDraw", COLOR_GPU, &vid);
 
     //debug("Visiting VertexIndexDraw");
+    if (vid.drawBound.enabled && cullDraw(vid.drawBound, vid.arrays)) return;
+
     _state->record();
     vid.record(*(_state->_commandBuffer));
 }
@@ -350,6 +366,8 @@ void RecordTraversal::apply(const Geometry& geometry)
     GPU_INSTRUMENTATION_L3_NCO(instrumentation, *getCommandBuffer(), "Geometry", COLOR_GPU, &geometry);
 
     //debug("Visiting Geometry");
+    if (geometry.drawBound.enabled && cullDraw(geometry.drawBound, geometry.arrays)) return;
+
     _state->record();
     geometry.record(*(_state->_commandBuffer));
 }
@@ -88,6 +88,8 @@ void SecondaryCommandGraph::record(ref_ptr<RecordedCommandBuffers> recordedComma
     recordTraversal->setFrameStamp(frameStamp);
     recordTraversal->setDatabasePager(databasePager);
     recordTraversal->clearBins();
+    recordTraversal->numDrawsTested = 0;
+    recordTraversal->numDrawsCulled = 0;
 
     ref_ptr<CommandBuffer> commandBuffer;
     for (auto& cb : _commandBuffers)
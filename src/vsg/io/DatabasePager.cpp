@@ -17,6 +17,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/threading/atomics.h>
 #include <vsg/ui/ApplicationEvent.h>
 #include <vsg/utils/SharedObjects.h>
+#include <vsg/vk/ResourceRequirements.h>
 
 using namespace vsg;
 
@@ -174,6 +175,12 @@ void DatabasePager::start(uint32_t numReadThreads)
                     // compile plod
                     if (auto result = databasePager.compileManager->compile(subgraph))
                     {
+                        // estimate the memory used by the subgraph so it can be tracked against the pager's memory budgets
+                        CollectMemoryUsage collectMemoryUsage;
+                        subgraph->accept(collectMemoryUsage);
+                        plod->highResDataSize = collectMemoryUsage.dataSize;
+                        plod->highResDeviceMemorySize = collectMemoryUsage.deviceMemorySize;
+
                         plod->requestStatus.exchange(PagedLOD::MergeRequest);
 
                         // move to the merge queue;
@@ -234,6 +241,8 @@ void DatabasePager::request(ref_ptr<PagedLOD> plod)
     {
         if (compare_exchange(plod->requestStatus, PagedLOD::NoRequest, PagedLOD::ReadRequest))
         {
+            plod->requestTime = clock::now();
+
             // debug("DatabasePager::request(", plod.get(), ") adding to requestQueue ", plod->filename, ", ", plod->priority, " plod=", plod.get());
             _requestQueue->add(plod);
         }
@@ -267,6 +276,9 @@ void DatabasePager::updateSceneGraph(ref_ptr<FrameStamp> frameStamp, CompileResu
 
     auto nodes = _toMergeQueue->take_all(cr);
 
+    // merges carried over from previous frames are considered along with the newly compiled subgraphs
+    nodes.splice(nodes.begin(), _deferredMerges);
+
     std::list<ref_ptr<Object>> deleteList;
     std::list<ref_ptr<SharedObjects>> sharedObjectsToPrune;
 
@@ -317,14 +329,33 @@ void DatabasePager::updateSceneGraph(ref_ptr<FrameStamp> frameStamp, CompileResu
 
         debug("DatabasePager : activeList.count = ", pagedLODContainer->activeList.count, ", inactiveList.count = ", pagedLODContainer->inactiveList.count, ", total = ", total);
 
+        uint32_t targetNumInactive = pagedLODContainer->inactiveList.count;
         if ((nodes.size() + total) > targetMaxNumPagedLODWithHighResSubgraphs)
         {
             uint32_t numPagedLODHighRestSubgraphsToRemove = (static_cast<uint32_t>(nodes.size()) + total) - targetMaxNumPagedLODWithHighResSubgraphs;
-            uint32_t targetNumInactive = (numPagedLODHighRestSubgraphsToRemove < pagedLODContainer->inactiveList.count) ? (pagedLODContainer->inactiveList.count - numPagedLODHighRestSubgraphsToRemove) : 0;
+            targetNumInactive = (numPagedLODHighRestSubgraphsToRemove < pagedLODContainer->inactiveList.count) ? (pagedLODContainer->inactiveList.count - numPagedLODHighRestSubgraphsToRemove) : 0;
 
             debug("Need to remove, inactive count = ", pagedLODContainer->inactiveList.count, ", target = ", targetNumInactive);
+        }
+
+        // include the subgraphs about to be merged when checking the memory budgets
+        uint64_t mergeDataSize = 0;
+        uint64_t mergeDeviceMemorySize = 0;
+        for (auto& plod : nodes)
+        {
+            mergeDataSize += plod->highResDataSize;
+            mergeDeviceMemorySize += plod->highResDeviceMemorySize;
+        }
 
-            for (uint32_t index = pagedLODContainer->inactiveList.head; (index != 0) && (pagedLODContainer->inactiveList.count > targetNumInactive);)
+        auto overBudget = [&]() {
+            return (targetMaxDataSize > 0 && (dataSize + mergeDataSize) > targetMaxDataSize) ||
+                   (targetMaxDeviceMemorySize > 0 && (deviceMemorySize + mergeDeviceMemorySize) > targetMaxDeviceMemorySize);
+        };
+
+        if (pagedLODContainer->inactiveList.count > targetNumInactive || overBudget())
+        {
+            // inactive list is ordered from least to most recently used
+            for (uint32_t index = pagedLODContainer->inactiveList.head; (index != 0) && (pagedLODContainer->inactiveList.count > targetNumInactive || overBudget());)
             {
                 auto& element = elements[index];
                 index = element.next;
@@ -342,6 +373,11 @@ void DatabasePager::updateSceneGraph(ref_ptr<FrameStamp> frameStamp, CompileResu
                     deleteList.push_back(plod);
                     pagedLODContainer->remove(plod);
 
+                    dataSize -= std::min(dataSize, plod->highResDataSize);
+                    deviceMemorySize -= std::min(deviceMemorySize, plod->highResDeviceMemorySize);
+                    plod->highResDataSize = 0;
+                    plod->highResDeviceMemorySize = 0;
+
                     if (plod->options->sharedObjects)
                     {
                         if (std::find(sharedObjectsToPrune.begin(), sharedObjectsToPrune.end(), plod->options->sharedObjects) == sharedObjectsToPrune.end())
@@ -356,6 +392,8 @@ void DatabasePager::updateSceneGraph(ref_ptr<FrameStamp> frameStamp, CompileResu
         }
     }
 
+    mergeStats = {};
+
     if (!nodes.empty())
     {
 #define LOCAL_MUTEX 1
@@ -365,8 +403,36 @@ void DatabasePager::updateSceneGraph(ref_ptr<FrameStamp> frameStamp, CompileResu
 #endif
 
         debug("DatabasePager::updateSceneGraph() nodes to merge : nodes.size() = ", nodes.size(), ", ", numActiveRequests.load());
-        for (auto& plod : nodes)
+
+        bool mergeBudget = (maxMergeTimePerFrame > 0.0 || maxMergeBytesPerFrame > 0);
+        if (mergeBudget)
         {
+            nodes.sort([](const ref_ptr<PagedLOD>& lhs, const ref_ptr<PagedLOD>& rhs) { return lhs->priority > rhs->priority; });
+        }
+
+        auto mergeStartTime = clock::now();
+        uint64_t mergedBytes = 0;
+        double totalLatency = 0.0;
+        uint32_t numProcessed = 0;
+
+        for (auto itr = nodes.begin(); itr != nodes.end(); ++itr)
+        {
+            auto& plod = *itr;
+
+            // carry the remaining merges over to the next frame once a budget has been used up
+            if (mergeBudget && numProcessed > 0)
+            {
+                bool overTime = maxMergeTimePerFrame > 0.0 && std::chrono::duration<double>(clock::now() - mergeStartTime).count() >= maxMergeTimePerFrame;
+                bool overBytes = maxMergeBytesPerFrame > 0 && (mergedBytes + plod->highResDataSize + plod->highResDeviceMemorySize) > maxMergeBytesPerFrame;
+                if (overTime || overBytes)
+                {
+                    _deferredMerges.splice(_deferredMerges.end(), nodes, itr, nodes.end());
+                    break;
+                }
+            }
+
+            ++numProcessed;
+
             if (compare_exchange(plod->requestStatus, PagedLOD::MergeRequest, PagedLOD::Merging))
             {
                 debug("   Merged ", plod->filename, " after ", plod->requestCount.load(), " priority ", plod->priority.load(), " ", frameCount - plod->frameHighResLastUsed.load(), " plod = ", plod);
@@ -377,10 +443,22 @@ void DatabasePager::updateSceneGraph(ref_ptr<FrameStamp> frameStamp, CompileResu
                     plod->children[0].node = plod->pending;
                 }
 
+                dataSize += plod->highResDataSize;
+                deviceMemorySize += plod->highResDeviceMemorySize;
+                mergedBytes += plod->highResDataSize + plod->highResDeviceMemorySize;
+
+                double latency = std::chrono::duration<double>(mergeStartTime - plod->requestTime).count();
+                totalLatency += latency;
+                mergeStats.maximumLatency = std::max(mergeStats.maximumLatency, latency);
+                ++mergeStats.numMerged;
+
                 plod->requestStatus.exchange(PagedLOD::NoRequest);
             }
         }
-        numActiveRequests -= static_cast<uint32_t>(nodes.size());
+        numActiveRequests -= numProcessed;
+
+        mergeStats.numDeferred = static_cast<uint32_t>(_deferredMerges.size());
+        if (mergeStats.numMerged > 0) mergeStats.averageLatency = totalLatency / static_cast<double>(mergeStats.numMerged);
     }
     else
     {
@@ -388,4 +466,13 @@ void DatabasePager::updateSceneGraph(ref_ptr<FrameStamp> frameStamp, CompileResu
     }
 
     if (!deleteList.empty() || !sharedObjectsToPrune.empty()) _deleteQueue->add_prune(deleteList, sharedObjectsToPrune);
+
+    if (instrumentation)
+    {
+        instrumentation->plot("DatabasePager dataSize", static_cast<double>(dataSize));
+        instrumentation->plot("DatabasePager deviceMemorySize", static_cast<double>(deviceMemorySize));
+        instrumentation->plot("DatabasePager numMerged", static_cast<double>(mergeStats.numMerged));
+        instrumentation->plot("DatabasePager numDeferred", static_cast<double>(mergeStats.numDeferred));
+        instrumentation->plot("DatabasePager averageMergeLatency", mergeStats.averageLatency);
+    }
 }
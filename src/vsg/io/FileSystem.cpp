@@ -11,6 +11,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/io/FileSystem.h>
+#include <vsg/io/FindFileCache.h>
 #include <vsg/io/Logger.h>
 #include <vsg/io/Options.h>
 #include <vsg/io/stream.h>
@@ -162,20 +163,29 @@ Path vsg::findFile(const Path& filename, const Options* options)
         // if Options has a findFileCallback use it
         if (options->findFileCallback) return options->findFileCallback(filename, options);
 
+        // if Options has a findFileCache use it to avoid repeatedly checking the file system
+        auto exists = [cache = options->findFileCache.get()](const Path& path) { return cache ? cache->fileExists(path) : fileExists(path); };
+
         if (!options->paths.empty())
         {
             // if appropriate use the filename directly if it exists.
-            if (options->checkFilenameHint == Options::CHECK_ORIGINAL_FILENAME_EXISTS_FIRST && fileExists(filename)) return filename;
+            if (options->checkFilenameHint == Options::CHECK_ORIGINAL_FILENAME_EXISTS_FIRST && exists(filename)) return filename;
 
             // search for the file in the options specific paths.
-            if (auto path = findFile(filename, options->paths)) return path;
+            for (auto& path : options->paths)
+            {
+                Path fullpath = path / filename;
+                if (exists(fullpath)) return fullpath;
+            }
 
             // if appropriate use the filename directly if it exists.
-            if (options->checkFilenameHint == Options::CHECK_ORIGINAL_FILENAME_EXISTS_LAST && fileExists(filename))
+            if (options->checkFilenameHint == Options::CHECK_ORIGINAL_FILENAME_EXISTS_LAST && exists(filename))
                 return filename;
             else
                 return {};
         }
+
+        return exists(filename) ? filename : Path();
     }
 
     return fileExists(filename) ? filename : Path();
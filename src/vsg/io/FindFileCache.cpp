@@ -0,0 +1,107 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/FileSystem.h>
+#include <vsg/io/FindFileCache.h>
+
+using namespace vsg;
+
+FindFileCache::FindFileCache()
+{
+}
+
+FindFileCache::~FindFileCache()
+{
+}
+
+bool FindFileCache::fileExists(const Path& path)
+{
+    auto slash = path.find_last_of(Path::separators);
+    bool hasFileName = (slash == Path::npos) || (slash + 1) < path.size();
+    bool useIndex = indexDirectories && hasFileName && !trailingRelativePath(path);
+    Path directory = (useIndex && slash != Path::npos) ? path.substr(0, slash) : Path();
+    Path name = (useIndex && slash != Path::npos) ? path.substr(slash + 1) : path;
+
+    {
+        std::scoped_lock<std::mutex> lock(_mutex);
+
+        if (auto itr = _fileExists.find(path.native()); itr != _fileExists.end())
+        {
+            ++_stats.hits;
+            return itr->second;
+        }
+
+        ++_stats.misses;
+
+        if (useIndex)
+        {
+            if (auto dir_itr = _directoryContents.find(directory.native()); dir_itr != _directoryContents.end())
+            {
+                bool exists = dir_itr->second.count(name.native()) > 0;
+                _fileExists[path.native()] = exists;
+                return exists;
+            }
+        }
+    }
+
+    // query the file system without holding the lock so that other threads aren't blocked by slow file systems
+    bool exists = false;
+    if (useIndex)
+    {
+        std::unordered_set<Path::string_type> contents;
+        for (auto& entry : getDirectoryContents(directory ? directory : Path("."))) contents.insert(entry.native());
+        exists = contents.count(name.native()) > 0;
+
+        std::scoped_lock<std::mutex> lock(_mutex);
+
+        // another thread may have indexed the same directory in the meantime, in which case keep its contents
+        if (_directoryContents.try_emplace(directory.native(), std::move(contents)).second) ++_stats.directoriesIndexed;
+        _fileExists[path.native()] = exists;
+    }
+    else
+    {
+        exists = vsg::fileExists(path);
+
+        std::scoped_lock<std::mutex> lock(_mutex);
+        _fileExists[path.native()] = exists;
+    }
+
+    return exists;
+}
+
+void FindFileCache::clear()
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    _fileExists.clear();
+    _directoryContents.clear();
+}
+
+void FindFileCache::clear(const Path& directory)
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    _directoryContents.erase(directory.native());
+
+    for (auto itr = _fileExists.begin(); itr != _fileExists.end();)
+    {
+        if (filePath(itr->first) == directory)
+            itr = _fileExists.erase(itr);
+        else
+            ++itr;
+    }
+}
+
+FindFileCache::Stats FindFileCache::getStats() const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    return _stats;
+}
@@ -100,6 +100,14 @@ ref_ptr<Logger>& Logger::instance()
     return s_logger;
 }
 
+std::ostringstream& Logger::_threadStream()
+{
+    thread_local std::ostringstream stream;
+    stream.str({});
+    stream.clear();
+    return stream;
+}
+
 void Logger::redirect_std()
 {
     _override_cout.reset(new intercept_streambuf(this, LOGGER_INFO));
@@ -113,71 +121,67 @@ void Logger::debug_stream(PrintToStreamFunction print)
 {
     if (level > LOGGER_DEBUG) return;
 
-    std::scoped_lock<std::mutex> lock(_mutex);
-    _stream.str({});
-    _stream.clear();
+    auto& stream = _threadStream();
+    print(stream);
 
-    print(_stream);
+    auto lock = _lockImplementation();
 
-    debug_implementation(_stream.str());
+    debug_implementation(stream.str());
 }
 
 void Logger::info_stream(PrintToStreamFunction print)
 {
     if (level > LOGGER_INFO) return;
 
-    std::scoped_lock<std::mutex> lock(_mutex);
-    _stream.str({});
-    _stream.clear();
+    auto& stream = _threadStream();
+    print(stream);
 
-    print(_stream);
+    auto lock = _lockImplementation();
 
-    info_implementation(_stream.str());
+    info_implementation(stream.str());
 }
 
 void Logger::warn_stream(PrintToStreamFunction print)
 {
     if (level > LOGGER_WARN) return;
 
-    std::scoped_lock<std::mutex> lock(_mutex);
-    _stream.str({});
-    _stream.clear();
+    auto& stream = _threadStream();
+    print(stream);
 
-    print(_stream);
+    auto lock = _lockImplementation();
 
-    warn_implementation(_stream.str());
+    warn_implementation(stream.str());
 }
 
 void Logger::error_stream(PrintToStreamFunction print)
 {
     if (level > LOGGER_ERROR) return;
 
-    std::scoped_lock<std::mutex> lock(_mutex);
-    _stream.str({});
-    _stream.clear();
+    auto& stream = _threadStream();
+    print(stream);
 
-    print(_stream);
+    auto lock = _lockImplementation();
 
-    error_implementation(_stream.str());
+    error_implementation(stream.str());
 }
 
 void Logger::fatal_stream(PrintToStreamFunction print)
 {
     if (level > LOGGER_FATAL) return;
 
-    std::scoped_lock<std::mutex> lock(_mutex);
-    _stream.str({});
-    _stream.clear();
+    auto& stream = _threadStream();
+    print(stream);
 
-    print(_stream);
+    auto lock = _lockImplementation();
 
-    fatal_implementation(_stream.str());
+    fatal_implementation(stream.str());
 }
 
 void Logger::log(Level msg_level, const std::string_view& message)
 {
     if (level > msg_level) return;
-    std::scoped_lock<std::mutex> lock(_mutex);
+
+    auto lock = _lockImplementation();
 
     switch (msg_level)
     {
@@ -194,19 +198,18 @@ void Logger::log_stream(Level msg_level, PrintToStreamFunction print)
 {
     if (level > msg_level) return;
 
-    std::scoped_lock<std::mutex> lock(_mutex);
-    _stream.str({});
-    _stream.clear();
+    auto& stream = _threadStream();
+    print(stream);
 
-    print(_stream);
+    auto lock = _lockImplementation();
 
     switch (msg_level)
     {
-    case (LOGGER_DEBUG): debug_implementation(_stream.str()); break;
-    case (LOGGER_INFO): info_implementation(_stream.str()); break;
-    case (LOGGER_WARN): warn_implementation(_stream.str()); break;
-    case (LOGGER_ERROR): error_implementation(_stream.str()); break;
-    case (LOGGER_FATAL): fatal_implementation(_stream.str()); break;
+    case (LOGGER_DEBUG): debug_implementation(stream.str()); break;
+    case (LOGGER_INFO): info_implementation(stream.str()); break;
+    case (LOGGER_WARN): warn_implementation(stream.str()); break;
+    case (LOGGER_ERROR): error_implementation(stream.str()); break;
+    case (LOGGER_FATAL): fatal_implementation(stream.str()); break;
     default: break;
     }
 }
@@ -288,34 +291,52 @@ void ThreadLogger::print_id(FILE* out, std::thread::id id)
     }
 }
 
+void ThreadLogger::print(FILE* out, std::thread::id id, const std::string& prefix, const std::string_view& message)
+{
+    print_id(out, id);
+    fprintf(out, "%s%.*s\n", prefix.c_str(), static_cast<int>(message.length()), message.data());
+}
+
+void ThreadLogger::logFromThread(std::thread::id id, Level msg_level, const std::string_view& message)
+{
+    if (level > msg_level) return;
+
+    auto lock = _lockImplementation();
+
+    switch (msg_level)
+    {
+    case (LOGGER_DEBUG): print(stdout, id, debugPrefix, message); break;
+    case (LOGGER_INFO): print(stdout, id, infoPrefix, message); break;
+    case (LOGGER_WARN): print(stderr, id, warnPrefix, message); break;
+    case (LOGGER_ERROR): print(stderr, id, errorPrefix, message); break;
+    case (LOGGER_FATAL): print(stderr, id, fatalPrefix, message); break;
+    default: break;
+    }
+}
+
 void ThreadLogger::debug_implementation(const std::string_view& message)
 {
-    print_id(stdout, std::this_thread::get_id());
-    fprintf(stdout, "%s%.*s\n", debugPrefix.c_str(), static_cast<int>(message.length()), message.data());
+    print(stdout, std::this_thread::get_id(), debugPrefix, message);
 }
 
 void ThreadLogger::info_implementation(const std::string_view& message)
 {
-    print_id(stdout, std::this_thread::get_id());
-    fprintf(stdout, "%s%.*s\n", infoPrefix.c_str(), static_cast<int>(message.length()), message.data());
+    print(stdout, std::this_thread::get_id(), infoPrefix, message);
 }
 
 void ThreadLogger::warn_implementation(const std::string_view& message)
 {
-    print_id(stderr, std::this_thread::get_id());
-    fprintf(stderr, "%s%.*s\n", warnPrefix.c_str(), static_cast<int>(message.length()), message.data());
+    print(stderr, std::this_thread::get_id(), warnPrefix, message);
 }
 
 void ThreadLogger::error_implementation(const std::string_view& message)
 {
-    print_id(stderr, std::this_thread::get_id());
-    fprintf(stderr, "%s%.*s\n", errorPrefix.c_str(), static_cast<int>(message.length()), message.data());
+    print(stderr, std::this_thread::get_id(), errorPrefix, message);
 }
 
 void ThreadLogger::fatal_implementation(const std::string_view& message)
 {
-    print_id(stderr, std::this_thread::get_id());
-    fprintf(stderr, "%s%.*s\n", fatalPrefix.c_str(), static_cast<int>(message.length()), message.data());
+    print(stderr, std::this_thread::get_id(), fatalPrefix, message);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -343,3 +364,146 @@ void NullLogger::fatal_implementation(const std::string_view& message)
 {
     throw Exception{std::string(message)};
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// AsyncLogger
+//
+AsyncLogger::AsyncLogger(ref_ptr<Logger> in_logger, size_t queueSize) :
+    _logger(in_logger ? in_logger : ref_ptr<Logger>(StdLogger::create()))
+{
+    // pushing to the queue is thread safe so no need to serialize the *_implementation() calls
+    _serializeImplementation = false;
+    level = _logger->level;
+
+    // round up to power of two so positions can be mapped to messages with a mask
+    size_t capacity = 2;
+    while (capacity < queueSize) capacity *= 2;
+
+    _messages.reset(new Message[capacity]);
+    _mask = capacity - 1;
+    for (size_t i = 0; i < capacity; ++i) _messages[i].sequence.store(i, std::memory_order_relaxed);
+
+    _writerThread = std::thread([this]() { run(); });
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    _running = false;
+    _writerCondition.notify_one();
+    if (_writerThread.joinable()) _writerThread.join();
+
+    _logger->flush();
+}
+
+bool AsyncLogger::push(Level msg_level, const std::string_view& message)
+{
+    // bounded multi-producer queue, each message slot's sequence signals whether it's free for the producer or filled for the writer thread
+    size_t position = _enqueuePosition.load(std::memory_order_relaxed);
+    Message* slot = nullptr;
+    for (;;)
+    {
+        slot = &_messages[position & _mask];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+        if (diff == 0)
+        {
+            if (_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+        }
+        else if (diff < 0)
+        {
+            // queue is full
+            ++_numDroppedMessages;
+            return false;
+        }
+        else
+        {
+            position = _enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->level = msg_level;
+    slot->threadId = std::this_thread::get_id();
+    slot->text.assign(message.data(), message.size());
+    slot->sequence.store(position + 1, std::memory_order_release);
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_writerWaiting.load()) _writerCondition.notify_one();
+
+    return true;
+}
+
+void AsyncLogger::run()
+{
+    // a ThreadLogger would otherwise label every message with this writer thread's id
+    auto threadLogger = _logger.cast<ThreadLogger>();
+
+    size_t position = _dequeuePosition.load();
+    for (;;)
+    {
+        auto& slot = _messages[position & _mask];
+        if (slot.sequence.load(std::memory_order_acquire) == position + 1)
+        {
+            if (threadLogger)
+                threadLogger->logFromThread(slot.threadId, slot.level, std::string_view(slot.text));
+            else
+                _logger->log(slot.level, std::string_view(slot.text));
+
+            // release the slot for reuse by producers
+            slot.sequence.store(position + _mask + 1, std::memory_order_release);
+            _dequeuePosition.store(++position, std::memory_order_release);
+            continue;
+        }
+
+        if (!_running) break;
+
+        std::unique_lock<std::mutex> lock(_writerMutex);
+        _writerWaiting = true;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // check again after signalling that the writer is waiting in case a message was pushed in between, the timeout covers any missed notification.
+        if (slot.sequence.load(std::memory_order_acquire) != position + 1 && _running)
+        {
+            _writerCondition.wait_for(lock, std::chrono::milliseconds(10));
+        }
+        _writerWaiting = false;
+    }
+}
+
+void AsyncLogger::flush()
+{
+    size_t position = _enqueuePosition.load();
+    while (_dequeuePosition.load(std::memory_order_acquire) < position)
+    {
+        _writerCondition.notify_one();
+        std::this_thread::yield();
+    }
+
+    _logger->flush();
+}
+
+void AsyncLogger::debug_implementation(const std::string_view& message)
+{
+    push(LOGGER_DEBUG, message);
+}
+
+void AsyncLogger::info_implementation(const std::string_view& message)
+{
+    push(LOGGER_INFO, message);
+}
+
+void AsyncLogger::warn_implementation(const std::string_view& message)
+{
+    push(LOGGER_WARN, message);
+}
+
+void AsyncLogger::error_implementation(const std::string_view& message)
+{
+    push(LOGGER_ERROR, message);
+}
+
+void AsyncLogger::fatal_implementation(const std::string_view& message)
+{
+    flush();
+    _logger->fatal(message);
+}
@@ -306,10 +306,12 @@ ObjectFactory::ObjectFactory()
 
     // animation
     add<vsg::TransformKeyframes>();
+    add<vsg::CompressedTransformKeyframes>();
     add<vsg::TransformSampler>();
     add<vsg::CameraKeyframes>();
     add<vsg::CameraSampler>();
     add<vsg::MorphKeyframes>();
+    add<vsg::MorphTarget>();
     add<vsg::MorphSampler>();
     add<vsg::JointSampler>();
     add<vsg::Animation>();
@@ -10,6 +10,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/io/FindFileCache.h>
 #include <vsg/io/Options.h>
 #include <vsg/io/ReaderWriter.h>
 #include <vsg/state/DescriptorSetLayout.h>
@@ -44,6 +45,7 @@ Options::Options(const Options& options, const CopyOp& copyop) :
     checkFilenameHint(options.checkFilenameHint),
     paths(options.paths),
     findFileCallback(options.findFileCallback),
+    findFileCache(options.findFileCache),
     fileCache(options.fileCache),
     extensionHint(options.extensionHint),
     mapRGBtoRGBAHint(options.mapRGBtoRGBAHint),
@@ -54,6 +56,8 @@ Options::Options(const Options& options, const CopyOp& copyop) :
     instrumentation(options.instrumentation),
     findDynamicObjects(options.findDynamicObjects),
     propagateDynamicObjects(options.propagateDynamicObjects),
+    copyOnWriteDynamicData(options.copyOnWriteDynamicData),
+    computeDrawBounds(options.computeDrawBounds),
     instanceNodeHint(options.instanceNodeHint)
 {
     getOrCreateAuxiliary();
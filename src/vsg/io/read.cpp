@@ -18,6 +18,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/io/tile.h>
 #include <vsg/io/txt.h>
 #include <vsg/threading/OperationThreads.h>
+#include <vsg/utils/ComputeDrawBounds.h>
 #include <vsg/utils/FindDynamicObjects.h>
 #include <vsg/utils/PropagateDynamicObjects.h>
 #include <vsg/utils/SharedObjects.h>
@@ -28,7 +29,7 @@ ref_ptr<Object> vsg::read(const Path& filename, ref_ptr<const Options> options)
 {
     CPU_INSTRUMENTATION_L1_NC(options ? options->instrumentation.get() : nullptr, "read", COLOR_READ);
 
-    auto read_file = [&]() -> ref_ptr<Object> {
+    auto read_object = [&]() -> ref_ptr<Object> {
         if (options && !options->readerWriters.empty())
         {
             for (auto& readerWriter : options->readerWriters)
@@ -73,6 +74,16 @@ ref_ptr<Object> vsg::read(const Path& filename, ref_ptr<const Options> options)
         }
     };
 
+    auto read_file = [&]() -> ref_ptr<Object> {
+        auto object = read_object();
+        if (object && options && options->computeDrawBounds)
+        {
+            ComputeDrawBounds computeDrawBounds;
+            object->accept(computeDrawBounds);
+        }
+        return object;
+    };
+
     if (options && options->sharedObjects && options->sharedObjects->suitable(filename))
     {
         auto loadedObject = LoadedObject::create(filename, options);
@@ -103,7 +114,11 @@ ref_ptr<Object> vsg::read(const Path& filename, ref_ptr<const Options> options)
             auto duplicate = copyop.duplicate = new vsg::Duplicate;
             for (auto& object : loadedObject->dynamicObjects)
             {
-                duplicate->insert(object);
+                const Data* data = options->copyOnWriteDynamicData ? object->cast<Data>() : nullptr;
+                if (data)
+                    duplicate->insert(object, data->cloneSharingStorage());
+                else
+                    duplicate->insert(object);
             }
 
             vsg::info("loaded filename = ", filename, ", object = ", loadedObject->object, ", dynamicObjects.size() = ", loadedObject->dynamicObjects.size());
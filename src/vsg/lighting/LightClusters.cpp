@@ -0,0 +1,177 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/lighting/LightClusters.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace vsg;
+
+LightClusters::LightClusters(const uivec3& in_dimensions, uint32_t in_maxLightIndices) :
+    dimensions(std::max(in_dimensions.x, 1u), std::max(in_dimensions.y, 1u), std::max(in_dimensions.z, 1u)),
+    maxLightIndices(in_maxLightIndices)
+{
+    parameters = vec4Array::create(2);
+    grid = uivec2Array::create(dimensions.x * dimensions.y * dimensions.z);
+    indices = uintArray::create(std::max(maxLightIndices, 1u));
+
+    parameters->setValue("name", "lightClusterParameters");
+    grid->setValue("name", "lightClusterGrid");
+    indices->setValue("name", "lightClusterIndices");
+}
+
+LightClusters::~LightClusters()
+{
+}
+
+void LightClusters::clear()
+{
+    lights.clear();
+}
+
+void LightClusters::add(const dsphere& eyeSpaceBound)
+{
+    lights.push_back(eyeSpaceBound);
+}
+
+uint32_t LightClusters::slice(double distance) const
+{
+    if (distance <= _near) return 0;
+
+    double z = std::floor(std::log(distance) * _sliceScale + _sliceBias);
+    if (z >= static_cast<double>(dimensions.z)) return dimensions.z - 1;
+    return static_cast<uint32_t>(z);
+}
+
+void LightClusters::assign(const dmat4& projectionMatrix, double nearDistance, double farDistance)
+{
+    _near = std::max(nearDistance, 1e-6);
+    _far = std::min(farDistance, maxDistance);
+    if (_far <= _near) _far = _near * 2.0;
+
+    // exponential depth slices so that the clusters keep a similar aspect ratio with distance, slice = log(distance) * scale + bias
+    _sliceScale = static_cast<double>(dimensions.z) / std::log(_far / _near);
+    _sliceBias = -std::log(_near) * _sliceScale;
+
+    auto tile = [](double ndc, uint32_t dimension) -> uint32_t {
+        double t = std::floor((ndc + 1.0) * 0.5 * static_cast<double>(dimension));
+        if (t <= 0.0) return 0;
+        if (t >= static_cast<double>(dimension)) return dimension - 1;
+        return static_cast<uint32_t>(t);
+    };
+
+    // compute the range of clusters that each light overlaps
+    _lightRanges.resize(lights.size());
+    for (size_t i = 0; i < lights.size(); ++i)
+    {
+        const auto& light = lights[i];
+        auto& range = _lightRanges[i];
+
+        double distance = -light.center.z;
+        double d0 = std::max(distance - light.radius, _near);
+        double d1 = std::min(distance + light.radius, _far);
+        if (d0 > d1)
+        {
+            // light is entirely in front of the near plane or beyond the far plane
+            range.min.set(1, 1, 1);
+            range.max.set(0, 0, 0);
+            continue;
+        }
+
+        // the projected extents of a box are bounded by its projected corners, so project the corners of the light's eye space bounding box clamped to the depth range
+        dvec2 ndc_min(std::numeric_limits<double>::max(), std::numeric_limits<double>::max());
+        dvec2 ndc_max(-std::numeric_limits<double>::max(), -std::numeric_limits<double>::max());
+        for (double x : {light.center.x - light.radius, light.center.x + light.radius})
+        {
+            for (double y : {light.center.y - light.radius, light.center.y + light.radius})
+            {
+                for (double d : {d0, d1})
+                {
+                    auto clip = projectionMatrix * dvec4(x, y, -d, 1.0);
+                    double inv_w = 1.0 / clip.w;
+                    ndc_min.x = std::min(ndc_min.x, clip.x * inv_w);
+                    ndc_min.y = std::min(ndc_min.y, clip.y * inv_w);
+                    ndc_max.x = std::max(ndc_max.x, clip.x * inv_w);
+                    ndc_max.y = std::max(ndc_max.y, clip.y * inv_w);
+                }
+            }
+        }
+
+        if (ndc_max.x < -1.0 || ndc_min.x > 1.0 || ndc_max.y < -1.0 || ndc_min.y > 1.0)
+        {
+            // light is outside the view frustum
+            range.min.set(1, 1, 1);
+            range.max.set(0, 0, 0);
+            continue;
+        }
+
+        range.min.set(tile(ndc_min.x, dimensions.x), tile(ndc_min.y, dimensions.y), slice(d0));
+        range.max.set(tile(ndc_max.x, dimensions.x), tile(ndc_max.y, dimensions.y), slice(d1));
+    }
+
+    // count the lights in each cluster
+    _counts.assign(grid->size(), 0);
+    for (const auto& range : _lightRanges)
+    {
+        for (uint32_t z = range.min.z; z <= range.max.z; ++z)
+        {
+            for (uint32_t y = range.min.y; y <= range.max.y; ++y)
+            {
+                for (uint32_t x = range.min.x; x <= range.max.x; ++x)
+                {
+                    ++_counts[clusterIndex(x, y, z)];
+                }
+            }
+        }
+    }
+
+    // assign each cluster's offset into the indices, clamping the counts to fit maxLightIndices
+    uint32_t offset = 0;
+    for (size_t c = 0; c < _counts.size(); ++c)
+    {
+        uint32_t count = std::min(_counts[c], maxLightIndices - offset);
+        grid->at(c).set(offset, 0);
+        _counts[c] = count;
+        offset += count;
+    }
+
+    // fill in the light indices, using the grid's count as the insertion cursor
+    for (size_t i = 0; i < _lightRanges.size(); ++i)
+    {
+        const auto& range = _lightRanges[i];
+        for (uint32_t z = range.min.z; z <= range.max.z; ++z)
+        {
+            for (uint32_t y = range.min.y; y <= range.max.y; ++y)
+            {
+                for (uint32_t x = range.min.x; x <= range.max.x; ++x)
+                {
+                    auto c = clusterIndex(x, y, z);
+                    auto& cell = grid->at(c);
+                    if (cell.y < _counts[c])
+                    {
+                        indices->at(cell.x + cell.y) = static_cast<uint32_t>(i);
+                        ++cell.y;
+                    }
+                }
+            }
+        }
+    }
+
+    parameters->at(0).set(static_cast<float>(_near), static_cast<float>(_far), static_cast<float>(_sliceScale), static_cast<float>(_sliceBias));
+    parameters->at(1).set(static_cast<float>(dimensions.x), static_cast<float>(dimensions.y), static_cast<float>(dimensions.z), static_cast<float>(offset));
+
+    parameters->dirty();
+    grid->dirty();
+    indices->dirty();
+}
@@ -106,12 +106,66 @@ void Bin::add(State* state, double value, const Node* node)
     _elements.push_back(element);
 }
 
+int Bin::compareStateCommands(const Element& lhs, const Element& rhs) const
+{
+    auto lhs_itr = _stateCommands.begin() + lhs.stateCommandIndex;
+    auto lhs_end = lhs_itr + lhs.stateCommandCount;
+    auto rhs_itr = _stateCommands.begin() + rhs.stateCommandIndex;
+    auto rhs_end = rhs_itr + rhs.stateCommandCount;
+
+    for (; lhs_itr != lhs_end && rhs_itr != rhs_end; ++lhs_itr, ++rhs_itr)
+    {
+        if ((*lhs_itr)->slot < (*rhs_itr)->slot) return -1;
+        if ((*rhs_itr)->slot < (*lhs_itr)->slot) return 1;
+        if (*lhs_itr < *rhs_itr) return -1;
+        if (*rhs_itr < *lhs_itr) return 1;
+    }
+
+    if (lhs_itr != lhs_end) return 1;
+    if (rhs_itr != rhs_end) return -1;
+    return 0;
+}
+
+uint32_t Bin::countStateChanges() const
+{
+    uint32_t numStateChanges = 0;
+    const Element* previous = nullptr;
+    for (const auto& keyElement : _binElements)
+    {
+        const auto& element = _elements[keyElement.second];
+
+        auto itr = _stateCommands.begin() + element.stateCommandIndex;
+        auto end = itr + element.stateCommandCount;
+        if (previous)
+        {
+            // state commands are stored in slot order, so walk both lists together, counting commands that differ from the previous element in the same slot
+            auto previous_itr = _stateCommands.begin() + previous->stateCommandIndex;
+            auto previous_end = previous_itr + previous->stateCommandCount;
+            for (; itr != end; ++itr)
+            {
+                while (previous_itr != previous_end && (*previous_itr)->slot < (*itr)->slot) ++previous_itr;
+                if (previous_itr == previous_end || *previous_itr != *itr) ++numStateChanges;
+            }
+        }
+        else
+        {
+            numStateChanges += element.stateCommandCount;
+        }
+
+        previous = &element;
+    }
+    return numStateChanges;
+}
+
 void Bin::traverse(RecordTraversal& rt) const
 {
     //debug("Bin::traverse(RecordTraversal& visitor) ", sortOrder, " ", _binElements.size());
 
     auto state = rt.getState();
 
+    // only count state changes when instrumenting as it requires two extra passes over the elements
+    bool countChanges = rt.instrumentation.valid();
+
     switch (sortOrder)
     {
     case (ASCENDING):
@@ -122,6 +176,19 @@ void Bin::traverse(RecordTraversal& rt) const
         break;
     case (NO_SORT):
         break;
+    case (STATE_SORT):
+        if (countChanges) numStateChangesUnsorted = countStateChanges();
+        std::stable_sort(_binElements.begin(), _binElements.end(), [&](const KeyIndex& lhs, const KeyIndex& rhs) { return compareStateCommands(_elements[lhs.second], _elements[rhs.second]) < 0; });
+        if (countChanges) numStateChangesSorted = countStateChanges();
+        break;
+    case (STATE_SORT_ASCENDING):
+        if (countChanges) numStateChangesUnsorted = countStateChanges();
+        std::sort(_binElements.begin(), _binElements.end(), [&](const KeyIndex& lhs, const KeyIndex& rhs) {
+            int result = compareStateCommands(_elements[lhs.second], _elements[rhs.second]);
+            return (result != 0) ? (result < 0) : (lhs.first < rhs.first);
+        });
+        if (countChanges) numStateChangesSorted = countStateChanges();
+        break;
     }
 
     uint32_t previousMatrixIndex = static_cast<uint32_t>(_matrices.size());
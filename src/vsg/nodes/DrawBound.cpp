@@ -0,0 +1,105 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Array.h>
+#include <vsg/maths/box.h>
+#include <vsg/nodes/DrawBound.h>
+
+using namespace vsg;
+
+DrawBound::DrawBound(const DrawBound& rhs) :
+    enabled(rhs.enabled)
+{
+}
+
+DrawBound& DrawBound::operator=(const DrawBound& rhs)
+{
+    if (&rhs == this) return *this;
+
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    enabled = rhs.enabled;
+    _vertices = {};
+
+    auto sequence = _sequence.load(std::memory_order_relaxed);
+    _sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    _cachedVertices.store(nullptr, std::memory_order_relaxed);
+    _sequence.store(sequence + 2, std::memory_order_release);
+    return *this;
+}
+
+dsphere DrawBound::get(const BufferInfoList& arrays) const
+{
+    const Data* vertices = (!arrays.empty() && arrays.front()) ? arrays.front()->data.get() : nullptr;
+    if (!vertices) return {};
+
+    ModifiedCount modifiedCount;
+    vertices->getModifiedCount(modifiedCount);
+
+    // read the cached bound without locking, falling back to the lock when it's stale or being updated by another thread
+    auto sequence = _sequence.load(std::memory_order_acquire);
+    if ((sequence & 1) == 0 && _cachedVertices.load(std::memory_order_relaxed) == vertices && _cachedModifiedCount.load(std::memory_order_relaxed) == modifiedCount.count)
+    {
+        dsphere bound(_cachedBound[0].load(std::memory_order_relaxed), _cachedBound[1].load(std::memory_order_relaxed),
+                      _cachedBound[2].load(std::memory_order_relaxed), _cachedBound[3].load(std::memory_order_relaxed));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (_sequence.load(std::memory_order_relaxed) == sequence) return bound;
+    }
+
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    // another thread may have recomputed the bound while waiting for the lock
+    if (_vertices == vertices && _cachedModifiedCount.load(std::memory_order_relaxed) == modifiedCount.count)
+    {
+        return dsphere(_cachedBound[0].load(std::memory_order_relaxed), _cachedBound[1].load(std::memory_order_relaxed),
+                       _cachedBound[2].load(std::memory_order_relaxed), _cachedBound[3].load(std::memory_order_relaxed));
+    }
+
+    auto bound = compute(vertices);
+    _vertices = vertices;
+
+    sequence = _sequence.load(std::memory_order_relaxed);
+    _sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    _cachedVertices.store(vertices, std::memory_order_relaxed);
+    _cachedModifiedCount.store(modifiedCount.count, std::memory_order_relaxed);
+    for (size_t i = 0; i < 4; ++i) _cachedBound[i].store(bound[i], std::memory_order_relaxed);
+    _sequence.store(sequence + 2, std::memory_order_release);
+
+    return bound;
+}
+
+dsphere DrawBound::compute(const Data* vertices)
+{
+    auto computeBound = [](const auto& array) -> dsphere {
+        if (array.empty()) return {};
+
+        dbox extents;
+        for (const auto& v : array) extents.add(v.x, v.y, v.z);
+
+        dvec3 center = (extents.min + extents.max) * 0.5;
+        double radius2 = 0.0;
+        for (const auto& v : array) radius2 = std::max(radius2, length2(dvec3(v.x, v.y, v.z) - center));
+
+        return dsphere(center, std::sqrt(radius2));
+    };
+
+    if (auto v3a = vertices->cast<vec3Array>())
+        return computeBound(*v3a);
+    else if (auto v4a = vertices->cast<vec4Array>())
+        return computeBound(*v4a);
+    else if (auto dv3a = vertices->cast<dvec3Array>())
+        return computeBound(*dv3a);
+    else
+        return {};
+}
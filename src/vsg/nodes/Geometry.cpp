@@ -33,7 +33,8 @@ Geometry::Geometry(const Geometry& rhs, const CopyOp& copyop) :
     firstBinding(rhs.firstBinding),
     arrays(copyop(rhs.arrays)),
     indices(copyop(rhs.indices)),
-    commands(copyop(rhs.commands))
+    commands(copyop(rhs.commands)),
+    drawBound(rhs.drawBound)
 {
 }
 
@@ -29,7 +29,8 @@ VertexDraw::VertexDraw(const VertexDraw& rhs, const CopyOp& copyop) :
     firstVertex(rhs.firstVertex),
     firstInstance(rhs.firstInstance),
     firstBinding(rhs.firstBinding),
-    arrays(copyop(rhs.arrays))
+    arrays(copyop(rhs.arrays)),
+    drawBound(rhs.drawBound)
 
 {
 }
@@ -31,7 +31,8 @@ VertexIndexDraw::VertexIndexDraw(const VertexIndexDraw& rhs, const CopyOp& copyo
     firstInstance(rhs.firstInstance),
     firstBinding(rhs.firstBinding),
     arrays(copyop(rhs.arrays)),
-    indices(copyop(rhs.indices))
+    indices(copyop(rhs.indices)),
+    drawBound(rhs.drawBound)
 {
 }
 
@@ -52,6 +52,11 @@ ref_ptr<const vec3Array> ArrayState::vertexArray(uint32_t /*instanceIndex*/)
     return vertices;
 }
 
+bool ArrayState::instanceMatrix(uint32_t /*instanceIndex*/, dmat4& /*matrix*/)
+{
+    return false;
+}
+
 void ArrayState::apply(const vsg::BindGraphicsPipeline& bpg)
 {
     for (auto& pipelineState : bpg.pipeline->pipelineStates)
@@ -295,6 +300,15 @@ ref_ptr<const vec3Array> TranslationArrayState::vertexArray(uint32_t instanceInd
     return vertices;
 }
 
+bool TranslationArrayState::instanceMatrix(uint32_t instanceIndex, dmat4& matrix)
+{
+    auto translations = arrays[translationAttribute.binding].cast<vec3Array>();
+    if (!translations || instanceIndex >= translations->size()) return false;
+
+    matrix = translate(dvec3(translations->at(instanceIndex)));
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // TranslationRotationScaleArrayState
@@ -306,7 +320,11 @@ TranslationRotationScaleArrayState::TranslationRotationScaleArrayState()
 TranslationRotationScaleArrayState::TranslationRotationScaleArrayState(const TranslationRotationScaleArrayState& rhs) :
     Inherit(rhs),
     translation_attribute_location(rhs.translation_attribute_location),
-    translationAttribute(rhs.translationAttribute)
+    rotation_attribute_location(rhs.rotation_attribute_location),
+    scale_attribute_location(rhs.scale_attribute_location),
+    translationAttribute(rhs.translationAttribute),
+    rotationAttribute(rhs.rotationAttribute),
+    scaleAttribute(rhs.scaleAttribute)
 {
 }
 
@@ -360,6 +378,27 @@ ref_ptr<const vec3Array> TranslationRotationScaleArrayState::vertexArray(uint32_
     return vertices;
 }
 
+bool TranslationRotationScaleArrayState::instanceMatrix(uint32_t instanceIndex, dmat4& matrix)
+{
+    auto translations = arrays[translationAttribute.binding].cast<vec3Array>();
+    auto rotations = arrays[rotationAttribute.binding].cast<quatArray>();
+    auto scales = arrays[scaleAttribute.binding].cast<vec3Array>();
+
+    if (!translations || (instanceIndex >= translations->size()) ||
+        !rotations || (instanceIndex >= rotations->size()) ||
+        !scales || (instanceIndex >= scales->size()))
+    {
+        return false;
+    }
+
+    // a zero scale collapses the instance so can't be inverted, fallback to vertexArray(instanceIndex)
+    dvec3 scale(scales->at(instanceIndex));
+    if (scale.x == 0.0 || scale.y == 0.0 || scale.z == 0.0) return false;
+
+    matrix = translate(dvec3(translations->at(instanceIndex))) * rotate(dquat(rotations->at(instanceIndex))) * vsg::scale(scale);
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // DisplacementMapArrayState
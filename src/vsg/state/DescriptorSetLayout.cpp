@@ -61,6 +61,20 @@ void DescriptorSetLayout::getDescriptorPoolSizes(DescriptorPoolSizes& descriptor
     }
 }
 
+uint64_t DescriptorSetLayout::bindingsSignature() const
+{
+    // FNV-1a over the raw binding data, matching the memcmp based compare_value_container(..) used to test compatibility
+    uint64_t signature = 14695981039346656037ull;
+    auto ptr = reinterpret_cast<const uint8_t*>(bindings.data());
+    auto end = ptr + bindings.size() * sizeof(VkDescriptorSetLayoutBinding);
+    for (; ptr != end; ++ptr)
+    {
+        signature ^= *ptr;
+        signature *= 1099511628211ull;
+    }
+    return signature;
+}
+
 int DescriptorSetLayout::compare(const Object& rhs_object) const
 {
     int result = Object::compare(rhs_object);
@@ -164,6 +164,7 @@ VkResult Image::allocateAndBindMemory(Device* device, VkMemoryPropertyFlags memo
     {
         throw Exception{"Error: Failed to allocate DeviceMemory."};
     }
+    _vulkanData[device->deviceID].size = memRequirements.size;
     return bind(memory, offset);
 }
 
@@ -226,6 +227,7 @@ void Image::compile(Context& context)
     }
 
     vd.requiresDataCopy = data.valid();
+    vd.size = memRequirements.size;
 
     bind(deviceMemory, offset);
 }
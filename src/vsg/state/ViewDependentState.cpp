@@ -299,6 +299,18 @@ void ViewDependentState::init(ResourceRequirements& requirements)
     viewportDataBufferInfo = BufferInfo::create(viewportData.get());
     descriptorConfigurator->assignDescriptor("viewportData", BufferInfoList{viewportDataBufferInfo});
 
+    if (lightClusters)
+    {
+        for (auto data : {ref_ptr<Data>(lightClusters->parameters), ref_ptr<Data>(lightClusters->grid), ref_ptr<Data>(lightClusters->indices)})
+        {
+            data->properties.dataVariance = DYNAMIC_DATA_TRANSFER_AFTER_RECORD;
+        }
+
+        descriptorConfigurator->assignDescriptor("lightClusterParameters", BufferInfoList{BufferInfo::create(lightClusters->parameters)});
+        descriptorConfigurator->assignDescriptor("lightClusterGrid", BufferInfoList{BufferInfo::create(lightClusters->grid)});
+        descriptorConfigurator->assignDescriptor("lightClusterIndices", BufferInfoList{BufferInfo::create(lightClusters->indices)});
+    }
+
     // set up ShadowMaps
     auto shadowMapDirectSampler = Sampler::create();
     shadowMapDirectSampler->minFilter = VK_FILTER_NEAREST;
@@ -403,6 +415,9 @@ void ViewDependentState::init(ResourceRequirements& requirements)
         if (first_view)
         {
             shadowMap.view = View::create(*first_view);
+
+            // the View copy is shallow, so drop the first view's children to avoid recording its subgraph again
+            shadowMap.view->children.clear();
         }
         else
         {
@@ -412,7 +427,15 @@ void ViewDependentState::init(ResourceRequirements& requirements)
 
         shadowMap.view->mask = shadowMask;
         shadowMap.view->camera = Camera::create();
-        shadowMap.view->addChild(tcon);
+        if (multiFrustumCulling)
+        {
+            shadowMap.drawList = DrawList::create();
+            shadowMap.view->addChild(shadowMap.drawList);
+        }
+        else
+        {
+            shadowMap.view->addChild(tcon);
+        }
         shadowMap.view->camera->viewportState = viewportState;
 
         shadowMap.renderGraph = RenderGraph::create();
@@ -656,6 +679,10 @@ void ViewDependentState::traverse(RecordTraversal& rt) const
     auto n = -(clipToEye * dvec3(0.0, 0.0, 1.0)).z;
     auto f = -(clipToEye * dvec3(0.0, 0.0, 0.0)).z;
 
+    // cache the projection's near/far range for the light clusters, fragments outside any region of interest still map to the first and last slices so need their lights
+    double clusterNear = n;
+    double clusterFar = f;
+
     // if regions of interest have been found in the scene graph use them to clamp the near/far values.
     if (!rt.regionsOfInterest.empty())
     {
@@ -1040,11 +1067,51 @@ void ViewDependentState::traverse(RecordTraversal& rt) const
         }
     }
 
+    if (lightClusters)
+    {
+        // assign the point and spot light bounds, clusters index them in the same order as they appear in the lightData
+        lightClusters->clear();
+        for (auto& [mv, light] : pointLights)
+        {
+            lightClusters->add(dsphere(mv * light->position, std::sqrt(light->intensity / rt.intensityMinimum)));
+        }
+        for (auto& [mv, light] : spotLights)
+        {
+            lightClusters->add(dsphere(mv * light->position, std::sqrt(light->intensity / rt.intensityMinimum)));
+        }
+
+        lightClusters->assign(projectionMatrix, clusterNear, clusterFar);
+    }
+
     if (numLightDataChanges > 0)
     {
         lightData->dirty();
     }
 
+    if (requiresPerRenderShadowMaps && multiFrustumCulling && shadowMapIndex > 0 && shadowMaps.front().drawList)
+    {
+        // cull all the active shadow map views with a single traversal of the scene graph, filling in each shadow map view's DrawList
+        if (!multiFrustumCull) multiFrustumCull = MultiFrustumCull::create();
+
+        multiFrustumCull->views.resize(shadowMapIndex);
+        for (uint32_t i = 0; i < shadowMapIndex; ++i)
+        {
+            const auto& camera = shadowMaps[i].view->camera;
+            auto& viewFrustum = multiFrustumCull->views[i];
+            viewFrustum.projectionMatrix = camera->projectionMatrix->transform();
+            viewFrustum.viewMatrix = camera->viewMatrix->transform();
+            viewFrustum.drawList = shadowMaps[i].drawList;
+        }
+
+        // select LODs using the main view to match the behavior of the INHERIT_VIEWPOINT shadow map views
+        multiFrustumCull->lodProjectionMatrix = projectionMatrix;
+        multiFrustumCull->lodViewMatrix = viewMatrix;
+        multiFrustumCull->traversalMask = shadowMaps.front().view->mask;
+        multiFrustumCull->overrideMask = rt.overrideMask;
+
+        multiFrustumCull->cull(*view);
+    }
+
     if (requiresPerRenderShadowMaps && preRenderCommandGraph)
     {
         if (rt.instrumentation && !preRenderCommandGraph->instrumentation)
@@ -10,8 +10,10 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/core/Allocator.h>
 #include <vsg/io/Options.h>
 #include <vsg/threading/DeleteQueue.h>
+#include <vsg/threading/Latch.h>
 #include <vsg/ui/FrameStamp.h>
 
 using namespace vsg;
@@ -29,13 +31,100 @@ DeleteQueue::~DeleteQueue()
 {
 }
 
+DeleteQueue::Objects& DeleteQueue::_bucket(uint64_t bucketFrameCount)
+{
+    if (_frameBuckets.empty() || _frameBuckets.back().frameCount < bucketFrameCount)
+    {
+        // reuse the storage of previously released buckets to avoid reallocating the containers each frame
+        auto& bucket = _frameBuckets.emplace_back();
+        bucket.frameCount = bucketFrameCount;
+        if (!_recycledObjects.empty())
+        {
+            bucket.objects.swap(_recycledObjects.back());
+            _recycledObjects.pop_back();
+        }
+        return bucket.objects;
+    }
+
+    return _frameBuckets.back().objects;
+}
+
+size_t DeleteQueue::_release(Objects& objects, const clock::time_point* deadline)
+{
+    struct ReleaseOperation : public Operation
+    {
+        ReleaseOperation(ref_ptr<Object>* in_begin, ref_ptr<Object>* in_end, ref_ptr<Latch> in_latch) :
+            begin(in_begin),
+            end(in_end),
+            latch(in_latch) {}
+
+        void run() override
+        {
+            for (auto itr = begin; itr != end; ++itr) *itr = {};
+            latch->count_down();
+        }
+
+        ref_ptr<Object>* begin;
+        ref_ptr<Object>* end;
+        ref_ptr<Latch> latch;
+    };
+
+    // release objects from the end of the container in chunks so the deadline can be checked without resorting the container
+    const size_t serialChunkSize = 64;
+    size_t numThreads = operationThreads ? operationThreads->threads.size() : 0;
+
+    size_t numReleased = 0;
+    while (!objects.empty())
+    {
+        if (numThreads > 0 && objects.size() >= parallelReleaseThreshold)
+        {
+            size_t numBatches = numThreads + 1;
+            size_t chunkSize = std::min(objects.size(), parallelReleaseThreshold * numBatches);
+            size_t batchSize = (chunkSize + numBatches - 1) / numBatches;
+
+            // use latch to synchronize this thread with the release threads
+            auto latch = Latch::create(static_cast<int>(numBatches));
+
+            auto chunk_end = objects.data() + objects.size();
+            auto chunk_begin = chunk_end - chunkSize;
+            size_t numAdded = 0;
+            for (auto begin = chunk_begin; begin < chunk_end; begin += batchSize, ++numAdded)
+            {
+                operationThreads->add(ref_ptr<Operation>(new ReleaseOperation(begin, std::min(begin + batchSize, chunk_end), latch)));
+            }
+
+            // account for any rounding in the batch sizes leaving fewer batches than planned
+            for (; numAdded < numBatches; ++numAdded) latch->count_down();
+
+            // use this thread to release objects as well
+            operationThreads->run();
+
+            // wait till all the batches have completed
+            latch->wait();
+
+            objects.resize(objects.size() - chunkSize);
+            numReleased += chunkSize;
+        }
+        else
+        {
+            size_t chunkSize = std::min(objects.size(), serialChunkSize);
+            objects.resize(objects.size() - chunkSize);
+            numReleased += chunkSize;
+        }
+
+        if (deadline && clock::now() > *deadline) break;
+    }
+
+    return numReleased;
+}
+
 void DeleteQueue::advance(ref_ptr<FrameStamp> frameStamp)
 {
     std::scoped_lock lock(_mutex);
 
     frameCount = frameStamp->frameCount;
 
-    if (!_objectsToDelete.empty() && _objectsToDelete.front().frameCount <= frameStamp->frameCount)
+    if (!_frameBuckets.empty() && _frameBuckets.front().frameCount <= frameStamp->frameCount)
     {
         _cv.notify_one();
     }
@@ -43,7 +132,7 @@ void DeleteQueue::advance(ref_ptr<FrameStamp> frameStamp)
 
 void DeleteQueue::wait_then_clear()
 {
-    ObjectsToDelete objectsToDelete;
+    FrameBuckets frameBuckets;
     std::list<ref_ptr<SharedObjects>> sharedObjectsToPrune;
 
     {
@@ -53,23 +142,74 @@ void DeleteQueue::wait_then_clear()
         uint64_t previous_frameCount = frameCount.load();
 
         // wait until the conditional variable signals that an operation has been added
-        while ((_objectsToDelete.empty() || (frameCount.load() == previous_frameCount)) && _status->active())
+        while ((_frameBuckets.empty() || (frameCount.load() == previous_frameCount)) && _status->active())
         {
             _cv.wait_for(lock, waitDuration);
         }
-        auto last_itr = std::find_if(_objectsToDelete.begin(), _objectsToDelete.end(), [&](const ObjectToDelete& otd) { return otd.frameCount > frameCount; });
 
-        // use a swap of the container to keep the time the mutex is acquired as short as possible
-        objectsToDelete.splice(objectsToDelete.end(), _objectsToDelete, _objectsToDelete.begin(), last_itr);
+        // move the expired buckets out of the queue to keep the time the mutex is acquired as short as possible
+        while (!_frameBuckets.empty() && _frameBuckets.front().frameCount <= frameCount)
+        {
+            frameBuckets.push_back(std::move(_frameBuckets.front()));
+            _frameBuckets.pop_front();
+        }
 
         sharedObjectsToPrune.swap(_sharedObjectsToPrune);
     }
 
-    size_t numObjectsToDelete = objectsToDelete.size();
+    auto& allocator = Allocator::instance();
+    size_t availableBefore = allocator ? allocator->totalAvailableSize() : 0;
+
+    auto startTime = clock::now();
+    auto deadline = startTime + std::chrono::duration_cast<clock::duration>(std::chrono::duration<double, std::milli>(timeBudget));
+
+    size_t numObjectsDeleted = 0;
+    size_t numObjectsRemaining = 0;
+    for (auto& bucket : frameBuckets)
+    {
+        if (timeBudget > 0.0 && clock::now() > deadline) break;
+        numObjectsDeleted += _release(bucket.objects, (timeBudget > 0.0) ? &deadline : nullptr);
+    }
 
-    objectsToDelete.clear();
+    double duration = std::chrono::duration<double, std::chrono::milliseconds::period>(clock::now() - startTime).count();
+    size_t availableAfter = allocator ? allocator->totalAvailableSize() : 0;
 
-    if (numObjectsToDelete > 0)
+    {
+        std::scoped_lock lock(_mutex);
+
+        // return any objects not released within the time budget to the front of the queue, retaining their frame order
+        for (auto itr = frameBuckets.rbegin(); itr != frameBuckets.rend(); ++itr)
+        {
+            if (itr->objects.empty())
+            {
+                _recycledObjects.push_back(std::move(itr->objects));
+            }
+            else
+            {
+                numObjectsRemaining += itr->objects.size();
+                _frameBuckets.push_front(std::move(*itr));
+            }
+        }
+
+        // defer pruning of the SharedObjects until all the objects that might reference them have been released
+        if (numObjectsRemaining > 0)
+        {
+            for (auto& sharedObjects : sharedObjectsToPrune)
+            {
+                if (std::find(_sharedObjectsToPrune.begin(), _sharedObjectsToPrune.end(), sharedObjects) == _sharedObjectsToPrune.end())
+                    _sharedObjectsToPrune.push_back(sharedObjects);
+            }
+            sharedObjectsToPrune.clear();
+        }
+
+        _statistics.frameCount = frameCount;
+        _statistics.numObjectsDeleted = numObjectsDeleted;
+        _statistics.numObjectsRemaining = numObjectsRemaining;
+        _statistics.numBytesDeleted = (availableAfter > availableBefore) ? (availableAfter - availableBefore) : 0;
+        _statistics.duration = duration;
+    }
+
+    if (numObjectsDeleted > 0)
     {
         for (auto& sharedObjects : sharedObjectsToPrune)
         {
@@ -81,25 +221,49 @@ void DeleteQueue::wait_then_clear()
 
 void DeleteQueue::clear()
 {
-    ObjectsToDelete objectsToDelete;
+    FrameBuckets frameBuckets;
+    std::list<ref_ptr<SharedObjects>> sharedObjectsToPrune;
 
     // use a swap of the container to keep the time the mutex is acquired as short as possible
     {
         std::scoped_lock lock(_mutex);
-        objectsToDelete.swap(objectsToDelete);
+        frameBuckets.swap(_frameBuckets);
+        sharedObjectsToPrune.swap(_sharedObjectsToPrune);
     }
 
-    size_t numObjectsToDelete = objectsToDelete.size();
+    auto& allocator = Allocator::instance();
+    size_t availableBefore = allocator ? allocator->totalAvailableSize() : 0;
+    auto startTime = clock::now();
+
+    size_t numObjectsDeleted = 0;
+    for (auto& bucket : frameBuckets)
+    {
+        numObjectsDeleted += _release(bucket.objects, nullptr);
+    }
 
-    //vsg::info("DeleteQueue::clear(), releasing ", nodesToRelease.size());
-    objectsToDelete.clear();
+    double duration = std::chrono::duration<double, std::chrono::milliseconds::period>(clock::now() - startTime).count();
+    size_t availableAfter = allocator ? allocator->totalAvailableSize() : 0;
 
-    if (numObjectsToDelete > 0)
     {
-        for (auto& sharedObjects : _sharedObjectsToPrune)
+        std::scoped_lock lock(_mutex);
+        _statistics.frameCount = frameCount;
+        _statistics.numObjectsDeleted = numObjectsDeleted;
+        _statistics.numObjectsRemaining = 0;
+        _statistics.numBytesDeleted = (availableAfter > availableBefore) ? (availableAfter - availableBefore) : 0;
+        _statistics.duration = duration;
+    }
+
+    if (numObjectsDeleted > 0)
+    {
+        for (auto& sharedObjects : sharedObjectsToPrune)
         {
             sharedObjects->prune();
         }
-        _sharedObjectsToPrune.clear();
     }
 }
+
+DeleteQueue::Statistics DeleteQueue::getStatistics() const
+{
+    std::scoped_lock lock(_mutex);
+    return _statistics;
+}
@@ -0,0 +1,70 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/nodes/Group.h>
+#include <vsg/nodes/LOD.h>
+#include <vsg/nodes/QuadGroup.h>
+#include <vsg/threading/parallel_visit.h>
+
+using namespace vsg;
+
+bool SubgraphPartition::partitionable(const Node& node) const
+{
+    const auto& type = node.type_info();
+    return type == typeid(Group) || type == typeid(QuadGroup) || (partitionLOD && type == typeid(LOD));
+}
+
+void SubgraphPartition::partition(const Node& node, size_t targetNumTasks, std::vector<const Node*>& tasks) const
+{
+    tasks.clear();
+    tasks.push_back(&node);
+
+    std::vector<const Node*> nextLevel;
+    bool split = true;
+    while (split && tasks.size() < targetNumTasks)
+    {
+        split = false;
+        nextLevel.clear();
+        for (auto task : tasks)
+        {
+            if (!partitionable(*task))
+            {
+                nextLevel.push_back(task);
+                continue;
+            }
+
+            split = true;
+            if (auto group = task->cast<Group>())
+            {
+                for (auto& child : group->children)
+                {
+                    if (child) nextLevel.push_back(child.get());
+                }
+            }
+            else if (auto quadGroup = task->cast<QuadGroup>())
+            {
+                for (auto& child : quadGroup->children)
+                {
+                    if (child) nextLevel.push_back(child.get());
+                }
+            }
+            else if (auto lod = task->cast<LOD>())
+            {
+                for (auto& lodChild : lod->children)
+                {
+                    if (lodChild.node) nextLevel.push_back(lodChild.node.get());
+                }
+            }
+        }
+        tasks.swap(nextLevel);
+    }
+}
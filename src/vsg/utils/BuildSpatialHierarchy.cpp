@@ -0,0 +1,277 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/app/CommandGraph.h>
+#include <vsg/app/RenderGraph.h>
+#include <vsg/app/View.h>
+#include <vsg/nodes/CullGroup.h>
+#include <vsg/threading/Latch.h>
+#include <vsg/utils/BuildSpatialHierarchy.h>
+#include <vsg/utils/ComputeBounds.h>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+using namespace vsg;
+
+namespace
+{
+    double surfaceArea(const dbox& bb)
+    {
+        if (!bb.valid()) return 0.0;
+        dvec3 size = bb.max - bb.min;
+        return 2.0 * (size.x * size.y + size.y * size.z + size.z * size.x);
+    }
+
+    dsphere boundingSphere(const dbox& bb)
+    {
+        dvec3 center = (bb.min + bb.max) * 0.5;
+        return dsphere(center, length(bb.max - center));
+    }
+} // namespace
+
+BuildSpatialHierarchy::BuildSpatialHierarchy()
+{
+}
+
+void BuildSpatialHierarchy::apply(Object& object)
+{
+    object.traverse(*this);
+}
+
+void BuildSpatialHierarchy::apply(CommandGraph& commandGraph)
+{
+    commandGraph.traverse(*this);
+}
+
+void BuildSpatialHierarchy::apply(RenderGraph& renderGraph)
+{
+    renderGraph.traverse(*this);
+}
+
+void BuildSpatialHierarchy::apply(View& view)
+{
+    view.traverse(*this);
+}
+
+void BuildSpatialHierarchy::apply(Group& group)
+{
+    if (_visited.count(&group) != 0) return;
+    _visited.insert(&group);
+
+    group.traverse(*this);
+
+    if (group.children.size() < std::max(minimumChildren, maximumLeafChildren + 1)) return;
+
+    Items items;
+    if (!_computeBounds(group, items)) return;
+
+    auto root = _build(items.begin(), items.end()).cast<CullGroup>();
+    if (!root) return;
+
+    // the rebuilt group takes the place of the root CullGroup
+    group.children = root->children;
+    --numCullGroupsCreated;
+    ++numGroupsRebuilt;
+}
+
+bool BuildSpatialHierarchy::_computeBounds(const Group& group, Items& items)
+{
+    items.resize(group.children.size());
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+        items[i].node = group.children[i];
+        if (!items[i].node) return false;
+    }
+
+    auto computeBounds = [&](size_t begin, size_t end) {
+        ComputeBounds cb;
+        cb.useNodeBounds = useNodeBounds;
+        for (size_t i = begin; i < end; ++i)
+        {
+            cb.bounds.reset();
+            items[i].node->accept(cb);
+            items[i].bounds = cb.bounds;
+            items[i].center = (cb.bounds.min + cb.bounds.max) * 0.5;
+        }
+    };
+
+    if (operationThreads && !operationThreads->threads.empty())
+    {
+        struct ComputeBoundsOperation : public Operation
+        {
+            ComputeBoundsOperation(std::function<void(size_t, size_t)> f, size_t b, size_t e, ref_ptr<Latch> l) :
+                function(f),
+                begin(b),
+                end(e),
+                latch(l) {}
+
+            void run() override
+            {
+                function(begin, end);
+                latch->count_down();
+            }
+
+            std::function<void(size_t, size_t)> function;
+            size_t begin;
+            size_t end;
+            ref_ptr<Latch> latch;
+        };
+
+        size_t numTasks = std::min(items.size(), (operationThreads->threads.size() + 1) * 4);
+        size_t blockSize = (items.size() + numTasks - 1) / numTasks;
+        numTasks = (items.size() + blockSize - 1) / blockSize;
+
+        // use latch to synchronize this thread with the bounds computation threads
+        auto latch = Latch::create(numTasks);
+        for (size_t begin = 0; begin < items.size(); begin += blockSize)
+        {
+            operationThreads->add(ref_ptr<Operation>(new ComputeBoundsOperation(computeBounds, begin, std::min(begin + blockSize, items.size()), latch)));
+        }
+
+        // use this thread to compute bounds as well
+        operationThreads->run();
+
+        // wait till all the operations have completed
+        latch->wait();
+    }
+    else
+    {
+        computeBounds(0, items.size());
+    }
+
+    return std::all_of(items.begin(), items.end(), [](const Item& item) { return item.bounds.valid(); });
+}
+
+BuildSpatialHierarchy::Items::iterator BuildSpatialHierarchy::_split(Items::iterator begin, Items::iterator end)
+{
+    dbox centerBounds;
+    for (auto itr = begin; itr != end; ++itr) centerBounds.add(itr->center);
+
+    dvec3 extents = centerBounds.max - centerBounds.min;
+    int longestAxis = (extents.x >= extents.y && extents.x >= extents.z) ? 0 : ((extents.y >= extents.z) ? 1 : 2);
+
+    auto median = [&]() {
+        auto middle = begin + (end - begin) / 2;
+        std::nth_element(begin, middle, end, [longestAxis](const Item& lhs, const Item& rhs) { return lhs.center[longestAxis] < rhs.center[longestAxis]; });
+        return middle;
+    };
+
+    if (splitMethod == MEDIAN_SPLIT || extents[longestAxis] <= 0.0) return median();
+
+    // binned surface area heuristic, evaluating the split planes between bins on all three axes
+    constexpr int numBins = 16;
+    struct Bin
+    {
+        dbox bounds;
+        size_t count = 0;
+    };
+
+    double bestCost = std::numeric_limits<double>::max();
+    int bestAxis = -1;
+    int bestBin = 0;
+
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        if (extents[axis] <= 0.0) continue;
+
+        double scale = static_cast<double>(numBins) / extents[axis];
+        Bin bins[numBins];
+        for (auto itr = begin; itr != end; ++itr)
+        {
+            int b = std::min(numBins - 1, static_cast<int>((itr->center[axis] - centerBounds.min[axis]) * scale));
+            bins[b].bounds.add(itr->bounds);
+            ++bins[b].count;
+        }
+
+        // accumulate the area and count of the bins to the right of each split plane
+        double rightArea[numBins];
+        size_t rightCount[numBins];
+        dbox rightBounds;
+        size_t count = 0;
+        for (int b = numBins - 1; b > 0; --b)
+        {
+            rightBounds.add(bins[b].bounds);
+            count += bins[b].count;
+            rightArea[b] = surfaceArea(rightBounds);
+            rightCount[b] = count;
+        }
+
+        dbox leftBounds;
+        count = 0;
+        for (int b = 0; b < numBins - 1; ++b)
+        {
+            leftBounds.add(bins[b].bounds);
+            count += bins[b].count;
+            if (count == 0 || rightCount[b + 1] == 0) continue;
+
+            double cost = surfaceArea(leftBounds) * static_cast<double>(count) + rightArea[b + 1] * static_cast<double>(rightCount[b + 1]);
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestAxis = axis;
+                bestBin = b;
+            }
+        }
+    }
+
+    if (bestAxis < 0) return median();
+
+    double scale = static_cast<double>(numBins) / extents[bestAxis];
+    double minimum = centerBounds.min[bestAxis];
+    return std::partition(begin, end, [&](const Item& item) {
+        return std::min(numBins - 1, static_cast<int>((item.center[bestAxis] - minimum) * scale)) <= bestBin;
+    });
+}
+
+ref_ptr<Node> BuildSpatialHierarchy::_build(Items::iterator begin, Items::iterator end)
+{
+    auto cullGroup = CullGroup::create();
+    ++numCullGroupsCreated;
+
+    dbox bounds;
+    for (auto itr = begin; itr != end; ++itr) bounds.add(itr->bounds);
+    cullGroup->bound = boundingSphere(bounds);
+
+    if (static_cast<size_t>(end - begin) <= maximumLeafChildren)
+    {
+        for (auto itr = begin; itr != end; ++itr) cullGroup->addChild(itr->node);
+        return cullGroup;
+    }
+
+    // repeatedly split the largest range until there are branchingFactor ranges
+    std::vector<std::pair<Items::iterator, Items::iterator>> ranges;
+    ranges.emplace_back(begin, end);
+    while (ranges.size() < std::max(branchingFactor, 2u))
+    {
+        auto largest = std::max_element(ranges.begin(), ranges.end(), [](const auto& lhs, const auto& rhs) { return (lhs.second - lhs.first) < (rhs.second - rhs.first); });
+        if ((largest->second - largest->first) <= 1) break;
+
+        auto range = *largest;
+        auto middle = _split(range.first, range.second);
+        if (middle == range.first || middle == range.second) middle = range.first + (range.second - range.first) / 2;
+
+        *largest = {range.first, middle};
+        ranges.emplace_back(middle, range.second);
+    }
+
+    for (auto& [first, last] : ranges)
+    {
+        if ((last - first) == 1)
+            cullGroup->addChild(first->node);
+        else
+            cullGroup->addChild(_build(first, last));
+    }
+
+    return cullGroup;
+}
@@ -17,6 +17,7 @@
 #include <vsg/state/ViewportState.h>
 #include <vsg/state/material.h>
 #include <vsg/utils/Builder.h>
+#include <vsg/utils/ComputeDrawBounds.h>
 #include <vsg/utils/GraphicsPipelineConfigurator.h>
 
 using namespace vsg;
@@ -230,6 +231,12 @@ ref_ptr<Node> Builder::decorateAndCompileIfRequired(const GeometryInfo& info, co
 {
     ref_ptr<Node> subgraph = node;
 
+    if (info.drawBound && !info.positions && !stateInfo.displacementMap)
+    {
+        ComputeDrawBounds computeDrawBounds;
+        node->accept(computeDrawBounds);
+    }
+
     // create StateGroup as the root of the scene/command graph to hold the GraphicsPipeline, and binding of Descriptors to decorate the whole graph
     if (auto stateGroup = createStateGroup(stateInfo))
     {
@@ -30,16 +30,186 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/nodes/VertexIndexDraw.h>
 #include <vsg/text/Text.h>
 #include <vsg/text/TextGroup.h>
+#include <vsg/threading/Latch.h>
+#include <vsg/threading/parallel_visit.h>
 #include <vsg/utils/ComputeBounds.h>
 
 using namespace vsg;
 
+namespace
+{
+    // compute the bounds of a range of vertices, in local coordinates using float min/max when no matrix is provided
+    struct VertexBoundsOperation : public Operation
+    {
+        VertexBoundsOperation(const vec3Array& in_vertices, const ushortArray* in_ushort_indices, const uintArray* in_uint_indices, uint32_t in_begin, uint32_t in_end, const dmat4* in_matrix, ref_ptr<Latch> in_latch = {}) :
+            vertices(in_vertices),
+            ushort_indices(in_ushort_indices),
+            uint_indices(in_uint_indices),
+            begin(in_begin),
+            end(in_end),
+            matrix(in_matrix),
+            latch(in_latch) {}
+
+        const vec3Array& vertices;
+        const ushortArray* ushort_indices;
+        const uintArray* uint_indices;
+        uint32_t begin;
+        uint32_t end;
+        const dmat4* matrix;
+        ref_ptr<Latch> latch;
+        dbox bounds;
+
+        template<typename F>
+        void computeRange(F vertex)
+        {
+            if (matrix)
+            {
+                for (uint32_t i = begin; i < end; ++i)
+                {
+                    bounds.add((*matrix) * dvec3(vertex(i)));
+                }
+            }
+            else if (begin < end)
+            {
+                vec3 minimum = vertex(begin);
+                vec3 maximum = minimum;
+                for (uint32_t i = begin + 1; i < end; ++i)
+                {
+                    const vec3& v = vertex(i);
+                    minimum.x = std::min(minimum.x, v.x);
+                    minimum.y = std::min(minimum.y, v.y);
+                    minimum.z = std::min(minimum.z, v.z);
+                    maximum.x = std::max(maximum.x, v.x);
+                    maximum.y = std::max(maximum.y, v.y);
+                    maximum.z = std::max(maximum.z, v.z);
+                }
+                bounds.add(dvec3(minimum));
+                bounds.add(dvec3(maximum));
+            }
+        }
+
+        void compute()
+        {
+            if (ushort_indices)
+                computeRange([&](uint32_t i) -> const vec3& { return vertices.at(ushort_indices->at(i)); });
+            else if (uint_indices)
+                computeRange([&](uint32_t i) -> const vec3& { return vertices.at(uint_indices->at(i)); });
+            else
+                computeRange([&](uint32_t i) -> const vec3& { return vertices.at(i); });
+        }
+
+        void run() override
+        {
+            compute();
+            if (latch) latch->count_down();
+        }
+    };
+
+    void addTransformedBox(dbox& bounds, const dmat4& matrix, const dbox& bb)
+    {
+        bounds.add(matrix * bb.min);
+        bounds.add(matrix * dvec3(bb.max.x, bb.min.y, bb.min.z));
+        bounds.add(matrix * dvec3(bb.max.x, bb.max.y, bb.min.z));
+        bounds.add(matrix * dvec3(bb.min.x, bb.max.y, bb.min.z));
+        bounds.add(matrix * dvec3(bb.min.x, bb.min.y, bb.max.z));
+        bounds.add(matrix * dvec3(bb.max.x, bb.min.y, bb.max.z));
+        bounds.add(matrix * bb.max);
+        bounds.add(matrix * dvec3(bb.min.x, bb.max.y, bb.max.z));
+    }
+} // namespace
+
+bool BoundsCache::get(const Key& key, dbox& bounds) const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    auto itr = _entries.find(key);
+    if (itr == _entries.end()) return false;
+
+    const auto& entry = itr->second;
+    if (key.vertices->differentModifiedCount(entry.verticesModifiedCount)) return false;
+    if (key.indices && key.indices->differentModifiedCount(entry.indicesModifiedCount)) return false;
+
+    bounds = entry.bounds;
+    return true;
+}
+
+void BoundsCache::set(const Key& key, const dbox& bounds)
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    auto& entry = _entries[key];
+    key.vertices->getModifiedCount(entry.verticesModifiedCount);
+    if (key.indices) key.indices->getModifiedCount(entry.indicesModifiedCount);
+    entry.bounds = bounds;
+}
+
+size_t BoundsCache::prune()
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    size_t numRemoved = 0;
+    for (auto itr = _entries.begin(); itr != _entries.end();)
+    {
+        // the key holds a reference so a count of 1 means nothing outside the cache is using the array
+        const auto& key = itr->first;
+        if (key.vertices->referenceCount() == 1 || (key.indices && key.indices->referenceCount() == 1))
+        {
+            itr = _entries.erase(itr);
+            ++numRemoved;
+        }
+        else
+        {
+            ++itr;
+        }
+    }
+    return numRemoved;
+}
+
+void BoundsCache::clear()
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    _entries.clear();
+}
+
+size_t BoundsCache::size() const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    return _entries.size();
+}
+
 ComputeBounds::ComputeBounds(ref_ptr<ArrayState> intialArrayState)
 {
     arrayStateStack.reserve(4);
     arrayStateStack.emplace_back(intialArrayState ? intialArrayState : ArrayState::create());
 }
 
+void ComputeBounds::traverseInParallel(const Node& node)
+{
+    auto clone = [](const ComputeBounds& cb) {
+        auto copy = ComputeBounds::create(cb.arrayStateStack.back()->cloneArrayState());
+        copy->traversalMask = cb.traversalMask;
+        copy->overrideMask = cb.overrideMask;
+        copy->useNodeBounds = cb.useNodeBounds;
+        copy->matrixStack = cb.matrixStack;
+        copy->instanceNode = cb.instanceNode;
+        copy->ushort_indices = cb.ushort_indices;
+        copy->uint_indices = cb.uint_indices;
+        copy->boundsCache = cb.boundsCache;
+        // operationThreads are left unassigned as the subgraphs are already being traversed in parallel
+        return copy;
+    };
+
+    auto reduce = [](ComputeBounds& cb, const ComputeBounds& subgraph) {
+        // subgraph bounds are computed with the inherited matrixStack so are already in the same coordinate frame
+        cb.bounds.add(subgraph.bounds);
+    };
+
+    SubgraphPartition subgraphPartition;
+    subgraphPartition.partitionLOD = !useNodeBounds;
+
+    parallel_visit(*this, node, operationThreads.get(), clone, reduce, subgraphPartition);
+}
+
 void ComputeBounds::apply(const vsg::Object& object)
 {
     object.traverse(*this);
@@ -226,18 +396,18 @@ void ComputeBounds::applyDraw(uint32_t firstVertex, uint32_t vertexCount, uint32
 {
     auto& arrayState = *arrayStateStack.back();
     uint32_t lastIndex = instanceCount > 1 ? (firstInstance + instanceCount) : firstInstance + 1;
-    uint32_t endVertex = firstVertex + vertexCount;
     dmat4 matrix;
     if (!matrixStack.empty()) matrix = matrixStack.back();
 
+    dmat4 instanceMatrix;
     for (uint32_t instanceIndex = firstInstance; instanceIndex < lastIndex; ++instanceIndex)
     {
-        if (auto vertices = arrayState.vertexArray(instanceIndex))
+        // when the instance is an affine transform of the vertices, fold it into the matrix rather than copying the vertices
+        bool useInstanceMatrix = arrayState.instanceMatrix(instanceIndex, instanceMatrix);
+        if (auto vertices = useInstanceMatrix ? arrayState.vertices : arrayState.vertexArray(instanceIndex))
         {
-            for (uint32_t i = firstVertex; i < endVertex; ++i)
-            {
-                bounds.add(matrix * dvec3(vertices->at(i)));
-            }
+            dmat4 vertexMatrix = useInstanceMatrix ? (matrix * instanceMatrix) : matrix;
+            addVertices(vertices, vertices == arrayState.vertices, false, firstVertex, vertexCount, vertexMatrix);
         }
     }
 }
@@ -246,38 +416,101 @@ void ComputeBounds::applyDrawIndexed(uint32_t firstIndex, uint32_t indexCount, u
 {
     auto& arrayState = *arrayStateStack.back();
     uint32_t lastIndex = instanceCount > 1 ? (firstInstance + instanceCount) : firstInstance + 1;
-    uint32_t endIndex = firstIndex + indexCount;
     dmat4 matrix;
     if (!matrixStack.empty()) matrix = matrixStack.back();
 
-    if (ushort_indices)
+    dmat4 instanceMatrix;
+    for (uint32_t instanceIndex = firstInstance; instanceIndex < lastIndex; ++instanceIndex)
     {
-        for (uint32_t instanceIndex = firstInstance; instanceIndex < lastIndex; ++instanceIndex)
+        // when the instance is an affine transform of the vertices, fold it into the matrix rather than copying the vertices
+        bool useInstanceMatrix = arrayState.instanceMatrix(instanceIndex, instanceMatrix);
+        auto vertices = useInstanceMatrix ? arrayState.vertices : arrayState.vertexArray(instanceIndex);
+        if (!vertices) continue;
+
+        dmat4 vertexMatrix = useInstanceMatrix ? (matrix * instanceMatrix) : matrix;
+        if (ushort_indices || uint_indices)
         {
-            if (auto vertices = arrayState.vertexArray(instanceIndex))
-            {
-                for (uint32_t i = firstIndex; i < endIndex; ++i)
-                {
-                    bounds.add(matrix * dvec3(vertices->at(ushort_indices->at(i))));
-                }
-            }
+            addVertices(vertices, vertices == arrayState.vertices, true, firstIndex, indexCount, vertexMatrix);
         }
     }
-    else if (uint_indices)
+}
+
+void ComputeBounds::addVertices(ref_ptr<const vec3Array> vertices, bool cacheable, bool indexed, uint32_t first, uint32_t count, const dmat4& matrix)
+{
+    if (count == 0) return;
+
+    if (boundsCache && cacheable)
     {
-        for (uint32_t instanceIndex = firstInstance; instanceIndex < lastIndex; ++instanceIndex)
+        BoundsCache::Key key;
+        key.vertices = vertices;
+        if (indexed) key.indices = ushort_indices ? ref_ptr<const Data>(ushort_indices) : ref_ptr<const Data>(uint_indices);
+        key.first = first;
+        key.count = count;
+
+        dbox localBounds;
+        if (!boundsCache->get(key, localBounds))
         {
-            if (auto vertices = arrayState.vertexArray(instanceIndex))
-            {
-                for (uint32_t i = firstIndex; i < endIndex; ++i)
-                {
-                    bounds.add(matrix * dvec3(vertices->at(uint_indices->at(i))));
-                }
-            }
+            localBounds = computeVertexBounds(*vertices, indexed, first, count, nullptr);
+            boundsCache->set(key, localBounds);
         }
+
+        if (localBounds.valid()) addTransformedBox(bounds, matrix, localBounds);
+    }
+    else
+    {
+        auto bb = computeVertexBounds(*vertices, indexed, first, count, &matrix);
+        if (bb.valid()) bounds.add(bb);
     }
 }
 
+dbox ComputeBounds::computeVertexBounds(const vec3Array& vertices, bool indexed, uint32_t first, uint32_t count, const dmat4* matrix)
+{
+    const ushortArray* ushort_ptr = indexed ? ushort_indices.get() : nullptr;
+    const uintArray* uint_ptr = (indexed && !ushort_ptr) ? uint_indices.get() : nullptr;
+    uint32_t end = first + count;
+
+    size_t numBatches = 1;
+    if (operationThreads && count > parallelVertexThreshold)
+    {
+        numBatches = std::min(operationThreads->threads.size() + 1, static_cast<size_t>(count / std::max(parallelVertexThreshold / 2u, 1u)));
+    }
+
+    if (numBatches <= 1)
+    {
+        VertexBoundsOperation operation(vertices, ushort_ptr, uint_ptr, first, end, matrix);
+        operation.compute();
+        return operation.bounds;
+    }
+
+    // use latch to synchronize this thread with the threads computing the batches
+    auto latch = Latch::create(static_cast<int>(numBatches));
+
+    std::vector<ref_ptr<VertexBoundsOperation>> operations;
+    uint32_t batchSize = static_cast<uint32_t>((count + numBatches - 1) / numBatches);
+    for (uint32_t begin = first; begin < end; begin += batchSize)
+    {
+        auto operation = ref_ptr<VertexBoundsOperation>(new VertexBoundsOperation(vertices, ushort_ptr, uint_ptr, begin, std::min(begin + batchSize, end), matrix, latch));
+        operations.push_back(operation);
+        operationThreads->add(operation);
+    }
+
+    // account for any rounding in the batch sizes leaving fewer batches than planned
+    for (size_t i = operations.size(); i < numBatches; ++i) latch->count_down();
+
+    // use this thread to compute batches as well
+    operationThreads->run();
+
+    // wait till all the batches have completed
+    latch->wait();
+
+    dbox bb;
+    for (auto& operation : operations)
+    {
+        if (operation->bounds.valid()) bb.add(operation->bounds);
+    }
+    return bb;
+}
+
 void ComputeBounds::apply(const Text& text)
 {
     if (text.technique) text.technique->accept(*this);
@@ -302,15 +535,7 @@ void ComputeBounds::add(const dbox& bb)
     }
     else
     {
-        auto& matrix = matrixStack.back();
-        bounds.add(matrix * bb.min);
-        bounds.add(matrix * dvec3(bb.max.x, bb.min.y, bb.min.z));
-        bounds.add(matrix * dvec3(bb.max.x, bb.max.y, bb.min.z));
-        bounds.add(matrix * dvec3(bb.min.x, bb.max.y, bb.min.z));
-        bounds.add(matrix * dvec3(bb.min.x, bb.min.y, bb.max.z));
-        bounds.add(matrix * dvec3(bb.max.x, bb.min.y, bb.max.z));
-        bounds.add(matrix * bb.max);
-        bounds.add(matrix * dvec3(bb.min.x, bb.max.y, bb.max.z));
+        addTransformedBox(bounds, matrixStack.back(), bb);
     }
 }
 
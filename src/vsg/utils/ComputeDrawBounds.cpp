@@ -0,0 +1,72 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/commands/Draw.h>
+#include <vsg/commands/DrawIndexed.h>
+#include <vsg/nodes/Geometry.h>
+#include <vsg/nodes/InstanceNode.h>
+#include <vsg/nodes/VertexDraw.h>
+#include <vsg/nodes/VertexIndexDraw.h>
+#include <vsg/utils/ComputeDrawBounds.h>
+
+using namespace vsg;
+
+void ComputeDrawBounds::apply(Node& node)
+{
+    node.traverse(*this);
+}
+
+void ComputeDrawBounds::apply(InstanceNode&)
+{
+    // the children of an InstanceNode are drawn at each instance position so don't traverse them
+}
+
+void ComputeDrawBounds::apply(VertexDraw& vd)
+{
+    if (vd.instanceCount <= 1) enable(vd.drawBound, vd.arrays);
+}
+
+void ComputeDrawBounds::apply(VertexIndexDraw& vid)
+{
+    if (vid.instanceCount <= 1) enable(vid.drawBound, vid.arrays);
+}
+
+void ComputeDrawBounds::apply(Geometry& geometry)
+{
+    for (auto& command : geometry.commands)
+    {
+        if (auto draw = command.cast<Draw>())
+        {
+            if (draw->instanceCount > 1) return;
+        }
+        else if (auto drawIndexed = command.cast<DrawIndexed>())
+        {
+            if (drawIndexed->instanceCount > 1) return;
+        }
+        else
+        {
+            // unable to determine whether other draw commands are instanced
+            return;
+        }
+    }
+
+    enable(geometry.drawBound, geometry.arrays);
+}
+
+void ComputeDrawBounds::enable(DrawBound& drawBound, const BufferInfoList& arrays)
+{
+    // only enable when the vertex array has a supported type
+    if (!drawBound.get(arrays).valid()) return;
+
+    drawBound.enabled = true;
+    ++numDrawBoundsEnabled;
+}
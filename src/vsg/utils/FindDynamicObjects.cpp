@@ -72,6 +72,9 @@ void FindDynamicObjects::apply(const MorphSampler& sampler)
 {
     tag(&sampler);
     tag(sampler.object);
+    tag(sampler.vertices);
+    tag(sampler.normals);
+    tag(sampler.weights);
 }
 
 void FindDynamicObjects::apply(const JointSampler& sampler)
@@ -0,0 +1,480 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/commands/DrawIndexed.h>
+#include <vsg/nodes/Geometry.h>
+#include <vsg/nodes/VertexIndexDraw.h>
+#include <vsg/threading/Latch.h>
+#include <vsg/utils/ComputeBounds.h>
+#include <vsg/utils/GenerateLOD.h>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <set>
+
+using namespace vsg;
+
+namespace
+{
+    // symmetric 4x4 quadric storing the weighted squared distance to a set of planes
+    struct Quadric
+    {
+        double a00 = 0, a01 = 0, a02 = 0, a03 = 0;
+        double a11 = 0, a12 = 0, a13 = 0;
+        double a22 = 0, a23 = 0;
+        double a33 = 0;
+        double totalWeight = 0;
+
+        void add(const dvec4& p, double weight)
+        {
+            totalWeight += weight;
+            a00 += weight * p.x * p.x;
+            a01 += weight * p.x * p.y;
+            a02 += weight * p.x * p.z;
+            a03 += weight * p.x * p.w;
+            a11 += weight * p.y * p.y;
+            a12 += weight * p.y * p.z;
+            a13 += weight * p.y * p.w;
+            a22 += weight * p.z * p.z;
+            a23 += weight * p.z * p.w;
+            a33 += weight * p.w * p.w;
+        }
+
+        Quadric& operator+=(const Quadric& rhs)
+        {
+            a00 += rhs.a00;
+            a01 += rhs.a01;
+            a02 += rhs.a02;
+            a03 += rhs.a03;
+            a11 += rhs.a11;
+            a12 += rhs.a12;
+            a13 += rhs.a13;
+            a22 += rhs.a22;
+            a23 += rhs.a23;
+            a33 += rhs.a33;
+            totalWeight += rhs.totalWeight;
+            return *this;
+        }
+
+        double error(const dvec3& v) const
+        {
+            double e = a00 * v.x * v.x + 2.0 * a01 * v.x * v.y + 2.0 * a02 * v.x * v.z + 2.0 * a03 * v.x +
+                       a11 * v.y * v.y + 2.0 * a12 * v.y * v.z + 2.0 * a13 * v.y +
+                       a22 * v.z * v.z + 2.0 * a23 * v.z +
+                       a33;
+            // normalize by the total weight so the error is an area weighted mean squared distance
+            return (totalWeight > 0.0) ? std::max(e / totalWeight, 0.0) : 0.0;
+        }
+    };
+
+    struct Collapse
+    {
+        double cost;
+        uint32_t from;
+        uint32_t to;
+
+        bool operator<(const Collapse& rhs) const
+        {
+            if (cost != rhs.cost) return cost < rhs.cost;
+            if (from != rhs.from) return from < rhs.from;
+            return to < rhs.to;
+        }
+    };
+
+    std::vector<uint32_t> simplifyTriangles(const vec3Array& vertices, const vec3Array* normals, std::vector<uint32_t> triangles, uint32_t vertexOffset, size_t targetIndexCount, double maxError)
+    {
+        uint32_t numVertices = static_cast<uint32_t>(vertices.size()) - std::min(vertexOffset, static_cast<uint32_t>(vertices.size()));
+        for (auto index : triangles)
+        {
+            if (index >= numVertices) return triangles;
+        }
+
+        auto position = [&](uint32_t v) { return dvec3(vertices[v + vertexOffset]); };
+
+        // lock vertices that share their position with other vertices, as they are on attribute seams
+        std::vector<bool> locked(numVertices, false);
+        {
+            std::map<std::tuple<float, float, float>, uint32_t> positions;
+            std::set<uint32_t> used(triangles.begin(), triangles.end());
+            for (auto v : used)
+            {
+                const auto& p = vertices[v + vertexOffset];
+                auto [itr, inserted] = positions.emplace(std::make_tuple(p.x, p.y, p.z), v);
+                if (!inserted)
+                {
+                    locked[v] = true;
+                    locked[itr->second] = true;
+                }
+            }
+        }
+
+        // lock vertices on border edges, those with only one adjacent triangle
+        {
+            std::map<std::pair<uint32_t, uint32_t>, uint32_t> edges;
+            for (size_t t = 0; t < triangles.size(); t += 3)
+            {
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    uint32_t a = triangles[t + c], b = triangles[t + (c + 1) % 3];
+                    ++edges[std::make_pair(std::min(a, b), std::max(a, b))];
+                }
+            }
+            for (auto& [edge, count] : edges)
+            {
+                if (count == 1) locked[edge.first] = locked[edge.second] = true;
+            }
+        }
+
+        std::vector<Quadric> quadrics(numVertices);
+        for (size_t t = 0; t < triangles.size(); t += 3)
+        {
+            dvec3 p0 = position(triangles[t]), p1 = position(triangles[t + 1]), p2 = position(triangles[t + 2]);
+            dvec3 normal = cross(p1 - p0, p2 - p0);
+            double area = length(normal);
+            if (area <= 0.0) continue;
+
+            normal /= area;
+            dvec4 plane(normal.x, normal.y, normal.z, -dot(normal, p0));
+            for (size_t c = 0; c < 3; ++c) quadrics[triangles[t + c]].add(plane, area * 0.5);
+        }
+
+        std::vector<uint32_t> remap(numVertices);
+        std::vector<bool> touched(numVertices);
+        std::vector<uint32_t> adjacencyOffsets(numVertices + 1);
+        std::vector<uint32_t> adjacency;
+        std::vector<Collapse> collapses;
+
+        while (triangles.size() > targetIndexCount)
+        {
+            // vertex to triangle adjacency
+            std::fill(adjacencyOffsets.begin(), adjacencyOffsets.end(), 0);
+            for (auto v : triangles) ++adjacencyOffsets[v + 1];
+            for (uint32_t v = 0; v < numVertices; ++v) adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+            adjacency.resize(triangles.size());
+            {
+                std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+                for (size_t i = 0; i < triangles.size(); ++i) adjacency[fill[triangles[i]]++] = static_cast<uint32_t>(i / 3);
+            }
+
+            // cost of each half edge collapse, moving the from vertex onto the to vertex
+            collapses.clear();
+            for (size_t t = 0; t < triangles.size(); t += 3)
+            {
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    uint32_t a = triangles[t + c], b = triangles[t + (c + 1) % 3];
+                    for (auto [from, to] : {std::make_pair(a, b), std::make_pair(b, a)})
+                    {
+                        if (locked[from]) continue;
+
+                        Quadric q = quadrics[from];
+                        q += quadrics[to];
+                        dvec3 p = position(to);
+                        double cost = q.error(p);
+                        if (normals)
+                        {
+                            double edgeLength2 = length2(p - position(from));
+                            cost += (1.0 - dot(dvec3((*normals)[from + vertexOffset]), dvec3((*normals)[to + vertexOffset]))) * edgeLength2 * 0.5;
+                        }
+                        if (cost <= maxError) collapses.push_back(Collapse{cost, from, to});
+                    }
+                }
+            }
+
+            if (collapses.empty()) break;
+            std::sort(collapses.begin(), collapses.end());
+
+            for (uint32_t v = 0; v < numVertices; ++v) remap[v] = v;
+            std::fill(touched.begin(), touched.end(), false);
+
+            size_t triangleCount = triangles.size() / 3;
+            size_t targetTriangleCount = targetIndexCount / 3;
+            size_t numCollapses = 0;
+
+            for (auto& collapse : collapses)
+            {
+                if (triangleCount <= targetTriangleCount) break;
+                if (touched[collapse.from] || touched[collapse.to]) continue;
+
+                // reject collapses that would flip triangles
+                dvec3 target = position(collapse.to);
+                bool flipped = false;
+                size_t removed = 0;
+                for (uint32_t a = adjacencyOffsets[collapse.from]; a < adjacencyOffsets[collapse.from + 1] && !flipped; ++a)
+                {
+                    const uint32_t* tri = &triangles[adjacency[a] * 3];
+                    if (tri[0] == collapse.to || tri[1] == collapse.to || tri[2] == collapse.to)
+                    {
+                        ++removed;
+                        continue;
+                    }
+
+                    dvec3 p[3], moved[3];
+                    for (int c = 0; c < 3; ++c)
+                    {
+                        p[c] = position(tri[c]);
+                        moved[c] = (tri[c] == collapse.from) ? target : p[c];
+                    }
+                    if (dot(cross(p[1] - p[0], p[2] - p[0]), cross(moved[1] - moved[0], moved[2] - moved[0])) <= 0.0) flipped = true;
+                }
+                if (flipped) continue;
+
+                // lock the vertices of all the triangles adjacent to the collapse for the rest of this pass
+                for (auto v : {collapse.from, collapse.to})
+                {
+                    for (uint32_t a = adjacencyOffsets[v]; a < adjacencyOffsets[v + 1]; ++a)
+                    {
+                        const uint32_t* tri = &triangles[adjacency[a] * 3];
+                        touched[tri[0]] = touched[tri[1]] = touched[tri[2]] = true;
+                    }
+                }
+
+                remap[collapse.from] = collapse.to;
+                quadrics[collapse.to] += quadrics[collapse.from];
+                triangleCount -= removed;
+                ++numCollapses;
+            }
+
+            if (numCollapses == 0) break;
+
+            // apply the collapses and remove the degenerate triangles
+            size_t write = 0;
+            for (size_t t = 0; t < triangles.size(); t += 3)
+            {
+                uint32_t a = remap[triangles[t]], b = remap[triangles[t + 1]], c = remap[triangles[t + 2]];
+                if (a == b || b == c || c == a) continue;
+                triangles[write++] = a;
+                triangles[write++] = b;
+                triangles[write++] = c;
+            }
+            triangles.resize(write);
+        }
+
+        return triangles;
+    }
+
+    template<class A>
+    ref_ptr<Data> createIndices(const std::vector<uint32_t>& indices)
+    {
+        auto array = A::create(static_cast<uint32_t>(indices.size()));
+        for (size_t i = 0; i < indices.size(); ++i) array->set(i, static_cast<typename A::value_type>(indices[i]));
+        return array;
+    }
+
+    struct Mesh
+    {
+        Node* node = nullptr;
+        ref_ptr<vec3Array> vertices;
+        ref_ptr<vec3Array> normals;
+        ref_ptr<Data> indices;
+        uint32_t firstIndex = 0;
+        uint32_t indexCount = 0;
+        uint32_t vertexOffset = 0;
+        std::vector<ref_ptr<Data>> levelIndices;
+    };
+
+    // collect the nodes of the subgraph that are copied for each level, and the meshes to be simplified
+    class CollectMeshes : public Inherit<Visitor, CollectMeshes>
+    {
+    public:
+        std::set<const Object*> nodes;
+        std::vector<Mesh> meshes;
+
+        void apply(Node& node) override
+        {
+            if (nodes.insert(&node).second) node.traverse(*this);
+        }
+
+        void apply(VertexIndexDraw& vid) override
+        {
+            if (!nodes.insert(&vid).second) return;
+            if (vid.indices && vid.indices->data) add(vid, vid.arrays, vid.indices->data, vid.firstIndex, vid.indexCount, vid.vertexOffset);
+        }
+
+        void apply(Geometry& geometry) override
+        {
+            if (!nodes.insert(&geometry).second) return;
+            if (geometry.commands.size() != 1 || !geometry.indices || !geometry.indices->data) return;
+
+            auto drawIndexed = geometry.commands.front()->cast<DrawIndexed>();
+            if (!drawIndexed) return;
+
+            nodes.insert(drawIndexed);
+            add(geometry, geometry.arrays, geometry.indices->data, drawIndexed->firstIndex, drawIndexed->indexCount, drawIndexed->vertexOffset);
+        }
+
+        void add(Node& node, const BufferInfoList& arrays, ref_ptr<Data> indices, uint32_t firstIndex, uint32_t indexCount, uint32_t vertexOffset)
+        {
+            if (arrays.empty() || !arrays[0] || indices->dynamic()) return;
+
+            Mesh mesh;
+            mesh.node = &node;
+            mesh.vertices = arrays[0]->data.cast<vec3Array>();
+            if (arrays.size() > 1 && arrays[1]) mesh.normals = arrays[1]->data.cast<vec3Array>();
+            if (mesh.normals && mesh.vertices && mesh.normals->size() != mesh.vertices->size()) mesh.normals = {};
+            mesh.indices = indices;
+            mesh.firstIndex = firstIndex;
+            mesh.indexCount = indexCount;
+            mesh.vertexOffset = vertexOffset;
+            if (mesh.vertices && (indices->cast<ushortArray>() || indices->cast<uintArray>())) meshes.push_back(mesh);
+        }
+    };
+} // namespace
+
+GenerateLOD::GenerateLOD()
+{
+    levels.push_back(Level{0.2, 0.5f, 0.01f});
+    levels.push_back(Level{0.05, 0.2f, 0.03f});
+}
+
+GenerateLOD::~GenerateLOD()
+{
+}
+
+ref_ptr<Data> GenerateLOD::simplify(const vec3Array& vertices, const vec3Array* normals, const Data& indices, uint32_t firstIndex, uint32_t indexCount, uint32_t vertexOffset, float targetRatio, float targetError)
+{
+    auto ushort_indices = indices.cast<ushortArray>();
+    auto uint_indices = indices.cast<uintArray>();
+    if (!ushort_indices && !uint_indices) return {};
+
+    indexCount = std::min(indexCount, static_cast<uint32_t>(indices.valueCount()) - std::min(firstIndex, static_cast<uint32_t>(indices.valueCount())));
+    indexCount -= indexCount % 3;
+
+    std::vector<uint32_t> triangles(indexCount);
+    for (uint32_t i = 0; i < indexCount; ++i)
+    {
+        triangles[i] = ushort_indices ? ushort_indices->at(firstIndex + i) : uint_indices->at(firstIndex + i);
+    }
+
+    dbox bounds;
+    for (auto index : triangles)
+    {
+        if (index + vertexOffset < vertices.size()) bounds.add(vertices[index + vertexOffset]);
+    }
+    double radius = bounds.valid() ? length(bounds.max - bounds.min) * 0.5 : 0.0;
+    double maxError = (targetError * radius) * (targetError * radius);
+
+    size_t targetIndexCount = static_cast<size_t>(static_cast<double>(indexCount / 3) * std::clamp(targetRatio, 0.0f, 1.0f)) * 3;
+    auto simplified = simplifyTriangles(vertices, normals, std::move(triangles), vertexOffset, targetIndexCount, maxError);
+
+    if (ushort_indices)
+        return createIndices<ushortArray>(simplified);
+    else
+        return createIndices<uintArray>(simplified);
+}
+
+ref_ptr<LOD> GenerateLOD::generate(ref_ptr<Node> subgraph)
+{
+    if (!subgraph) return {};
+
+    CollectMeshes collectMeshes;
+    subgraph->accept(collectMeshes);
+
+    auto& meshes = collectMeshes.meshes;
+    for (auto& mesh : meshes) mesh.levelIndices.resize(levels.size());
+
+    auto simplifyMeshes = [&](size_t begin, size_t end) {
+        for (size_t m = begin; m < end; ++m)
+        {
+            auto& mesh = meshes[m];
+            for (size_t l = 0; l < levels.size(); ++l)
+            {
+                mesh.levelIndices[l] = simplify(*mesh.vertices, mesh.normals.get(), *mesh.indices, mesh.firstIndex, mesh.indexCount, mesh.vertexOffset, levels[l].targetRatio, levels[l].targetError);
+            }
+        }
+    };
+
+    if (operationThreads && !operationThreads->threads.empty() && meshes.size() > 1)
+    {
+        struct SimplifyOperation : public Operation
+        {
+            SimplifyOperation(std::function<void(size_t, size_t)> f, size_t m, ref_ptr<Latch> l) :
+                function(f),
+                mesh(m),
+                latch(l) {}
+
+            void run() override
+            {
+                function(mesh, mesh + 1);
+                latch->count_down();
+            }
+
+            std::function<void(size_t, size_t)> function;
+            size_t mesh;
+            ref_ptr<Latch> latch;
+        };
+
+        // use latch to synchronize this thread with the simplification threads
+        auto latch = Latch::create(meshes.size());
+        for (size_t m = 0; m < meshes.size(); ++m)
+        {
+            operationThreads->add(ref_ptr<Operation>(new SimplifyOperation(simplifyMeshes, m, latch)));
+        }
+
+        // use this thread to simplify meshes as well
+        operationThreads->run();
+
+        // wait till all the operations have completed
+        latch->wait();
+    }
+    else
+    {
+        simplifyMeshes(0, meshes.size());
+    }
+
+    auto lod = LOD::create();
+
+    ComputeBounds computeBounds;
+    subgraph->accept(computeBounds);
+    if (computeBounds.bounds.valid())
+    {
+        dvec3 center = (computeBounds.bounds.min + computeBounds.bounds.max) * 0.5;
+        lod->bound.set(center, length(computeBounds.bounds.max - center));
+    }
+
+    lod->addChild(LOD::Child{minimumScreenHeightRatio, subgraph});
+
+    for (size_t l = 0; l < levels.size(); ++l)
+    {
+        CopyOp copyop;
+        copyop.duplicate = new Duplicate;
+        for (auto& node : collectMeshes.nodes) copyop.duplicate->insert(node);
+
+        auto levelSubgraph = copyop(subgraph);
+
+        for (auto& mesh : meshes)
+        {
+            auto& indices = mesh.levelIndices[l];
+            if (!indices) continue;
+
+            auto copy = copyop.duplicate->find(mesh.node)->second;
+            if (auto vid = copy.cast<VertexIndexDraw>())
+            {
+                vid->assignIndices(indices);
+                vid->firstIndex = 0;
+                vid->indexCount = static_cast<uint32_t>(indices->valueCount());
+            }
+            else if (auto geometry = copy.cast<Geometry>())
+            {
+                geometry->assignIndices(indices);
+                auto drawIndexed = geometry->commands.front().cast<DrawIndexed>();
+                drawIndexed->firstIndex = 0;
+                drawIndexed->indexCount = static_cast<uint32_t>(indices->valueCount());
+            }
+        }
+
+        lod->addChild(LOD::Child{levels[l].minimumScreenHeightRatio, levelSubgraph});
+    }
+
+    return lod;
+}
@@ -0,0 +1,715 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Array2D.h>
+#include <vsg/threading/Latch.h>
+#include <vsg/utils/ImageProcessing.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <limits>
+
+using namespace vsg;
+
+namespace
+{
+    bool supportedFormat(VkFormat format, bool& srgb, bool& bgra)
+    {
+        switch (format)
+        {
+        case (VK_FORMAT_R8G8B8A8_UNORM): srgb = false; bgra = false; return true;
+        case (VK_FORMAT_R8G8B8A8_SRGB): srgb = true; bgra = false; return true;
+        case (VK_FORMAT_B8G8R8A8_UNORM): srgb = false; bgra = true; return true;
+        case (VK_FORMAT_B8G8R8A8_SRGB): srgb = true; bgra = true; return true;
+        default: return false;
+        }
+    }
+
+    uint32_t computeNumLevels(uint32_t width, uint32_t height)
+    {
+        uint32_t numLevels = 1;
+        while (width > 1 || height > 1)
+        {
+            if (width > 1) width /= 2;
+            if (height > 1) height /= 2;
+            ++numLevels;
+        }
+        return numLevels;
+    }
+
+    /// allocate an Array2D with space for all the mipmap levels specified by properties.maxNumMipmaps
+    template<class A>
+    ref_ptr<A> createMipmappedArray(uint32_t width, uint32_t height, Data::Properties properties)
+    {
+        using value_type = typename A::value_type;
+
+        properties.stride = 0;
+        properties.allocatorType = ALLOCATOR_TYPE_VSG_ALLOCATOR;
+
+        size_t count = Data::computeValueCountIncludingMipmaps(width, height, 1, properties.maxNumMipmaps);
+        auto values = new (vsg::allocate(sizeof(value_type) * count, ALLOCATOR_AFFINITY_DATA)) value_type[count];
+        return A::create(width, height, values, properties);
+    }
+
+    /// call function(begin, end) over the range [0, count), split into tasks across the operationThreads and this thread
+    void parallelFor(OperationThreads* operationThreads, uint32_t count, const std::function<void(uint32_t, uint32_t)>& function)
+    {
+        uint32_t numTasks = 1;
+        if (operationThreads && !operationThreads->threads.empty())
+        {
+            numTasks = std::min(count, static_cast<uint32_t>(operationThreads->threads.size() + 1) * 4);
+        }
+
+        if (numTasks <= 1)
+        {
+            function(0, count);
+            return;
+        }
+
+        struct RangeOperation : public Operation
+        {
+            RangeOperation(const std::function<void(uint32_t, uint32_t)>& f, uint32_t b, uint32_t e, ref_ptr<Latch> l) :
+                function(f),
+                begin(b),
+                end(e),
+                latch(l) {}
+
+            void run() override
+            {
+                function(begin, end);
+                latch->count_down();
+            }
+
+            const std::function<void(uint32_t, uint32_t)>& function;
+            uint32_t begin;
+            uint32_t end;
+            ref_ptr<Latch> latch;
+        };
+
+        // use latch to synchronize this thread with the processing threads
+        auto latch = Latch::create(static_cast<int>(numTasks));
+        for (uint32_t t = 0; t < numTasks; ++t)
+        {
+            uint32_t begin = static_cast<uint32_t>((static_cast<uint64_t>(count) * t) / numTasks);
+            uint32_t end = static_cast<uint32_t>((static_cast<uint64_t>(count) * (t + 1)) / numTasks);
+            operationThreads->add(ref_ptr<Operation>(new RangeOperation(function, begin, end, latch)));
+        }
+
+        // use this thread to process ranges as well
+        operationThreads->run();
+
+        // wait till all the operations have completed
+        latch->wait();
+    }
+
+    /// only use threads for levels large enough to amortize the cost of dispatching the operations
+    OperationThreads* threadsForWorkload(OperationThreads* operationThreads, size_t numValues)
+    {
+        return (numValues >= 65536) ? operationThreads : nullptr;
+    }
+
+    /// lookup tables for converting between sRGB and linear color space
+    struct ColorSpaceTables
+    {
+        static constexpr uint32_t linearResolution = 16384;
+
+        std::array<float, 256> toLinear;
+        std::array<uint8_t, linearResolution + 1> toSRGB;
+
+        ColorSpaceTables()
+        {
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                float c = static_cast<float>(i) / 255.0f;
+                toLinear[i] = (c <= 0.04045f) ? (c / 12.92f) : std::pow((c + 0.055f) / 1.055f, 2.4f);
+            }
+
+            for (uint32_t i = 0; i <= linearResolution; ++i)
+            {
+                float c = static_cast<float>(i) / static_cast<float>(linearResolution);
+                float s = (c <= 0.0031308f) ? (c * 12.92f) : (1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f);
+                toSRGB[i] = static_cast<uint8_t>(std::min(255.0f, s * 255.0f + 0.5f));
+            }
+        }
+
+        uint8_t linearToSRGB(float c) const
+        {
+            return toSRGB[static_cast<uint32_t>(std::clamp(c, 0.0f, 1.0f) * static_cast<float>(linearResolution) + 0.5f)];
+        }
+
+        static const ColorSpaceTables& instance()
+        {
+            static ColorSpaceTables s_tables;
+            return s_tables;
+        }
+    };
+
+    /// box filter a source level down into the rows [begin, end) of the next mipmap level
+    void downsampleRows(const ubvec4* source, uint32_t sourceWidth, uint32_t sourceHeight, ubvec4* dest, uint32_t destWidth, uint32_t begin, uint32_t end, bool srgb)
+    {
+        const auto& tables = ColorSpaceTables::instance();
+
+        for (uint32_t y = begin; y < end; ++y)
+        {
+            const ubvec4* row0 = source + static_cast<size_t>(std::min(y * 2, sourceHeight - 1)) * sourceWidth;
+            const ubvec4* row1 = source + static_cast<size_t>(std::min(y * 2 + 1, sourceHeight - 1)) * sourceWidth;
+            ubvec4* destRow = dest + static_cast<size_t>(y) * destWidth;
+
+            for (uint32_t x = 0; x < destWidth; ++x)
+            {
+                uint32_t x0 = std::min(x * 2, sourceWidth - 1);
+                uint32_t x1 = std::min(x * 2 + 1, sourceWidth - 1);
+                const ubvec4& p00 = row0[x0];
+                const ubvec4& p01 = row0[x1];
+                const ubvec4& p10 = row1[x0];
+                const ubvec4& p11 = row1[x1];
+
+                ubvec4& d = destRow[x];
+                if (srgb)
+                {
+                    for (int c = 0; c < 3; ++c)
+                    {
+                        d[c] = tables.linearToSRGB((tables.toLinear[p00[c]] + tables.toLinear[p01[c]] + tables.toLinear[p10[c]] + tables.toLinear[p11[c]]) * 0.25f);
+                    }
+                    d[3] = static_cast<uint8_t>((p00[3] + p01[3] + p10[3] + p11[3] + 2) >> 2);
+                }
+                else
+                {
+                    for (int c = 0; c < 4; ++c)
+                    {
+                        d[c] = static_cast<uint8_t>((p00[c] + p01[c] + p10[c] + p11[c] + 2) >> 2);
+                    }
+                }
+            }
+        }
+    }
+
+    /// 4x4 block of RGBA pixels, always in RGBA channel order
+    using PixelBlock = std::array<std::array<float, 4>, 16>;
+
+    /// compute the mean and the principal axis of the pixels in a block, considering the first numChannels channels
+    void computePrincipalAxis(const PixelBlock& pixels, int numChannels, float mean[4], float axis[4])
+    {
+        float minValue[4] = {255.0f, 255.0f, 255.0f, 255.0f};
+        float maxValue[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        for (int c = 0; c < 4; ++c) mean[c] = 0.0f;
+        for (auto& p : pixels)
+        {
+            for (int c = 0; c < numChannels; ++c)
+            {
+                mean[c] += p[c];
+                minValue[c] = std::min(minValue[c], p[c]);
+                maxValue[c] = std::max(maxValue[c], p[c]);
+            }
+        }
+        for (int c = 0; c < numChannels; ++c) mean[c] /= 16.0f;
+
+        float covariance[4][4] = {};
+        for (auto& p : pixels)
+        {
+            for (int i = 0; i < numChannels; ++i)
+            {
+                for (int j = i; j < numChannels; ++j)
+                {
+                    covariance[i][j] += (p[i] - mean[i]) * (p[j] - mean[j]);
+                }
+            }
+        }
+        for (int i = 0; i < numChannels; ++i)
+        {
+            for (int j = 0; j < i; ++j) covariance[i][j] = covariance[j][i];
+        }
+
+        // power iteration, starting from the diagonal of the bounding box
+        for (int c = 0; c < 4; ++c) axis[c] = (c < numChannels) ? (maxValue[c] - minValue[c]) : 0.0f;
+        for (int iteration = 0; iteration < 8; ++iteration)
+        {
+            float next[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+            for (int i = 0; i < numChannels; ++i)
+            {
+                for (int j = 0; j < numChannels; ++j) next[i] += covariance[i][j] * axis[j];
+            }
+
+            float length2 = 0.0f;
+            for (int c = 0; c < numChannels; ++c) length2 += next[c] * next[c];
+            if (length2 <= 0.0f) break;
+
+            float inverseLength = 1.0f / std::sqrt(length2);
+            for (int c = 0; c < numChannels; ++c) axis[c] = next[c] * inverseLength;
+        }
+
+        float length2 = 0.0f;
+        for (int c = 0; c < numChannels; ++c) length2 += axis[c] * axis[c];
+        if (length2 > 0.0f)
+        {
+            float inverseLength = 1.0f / std::sqrt(length2);
+            for (int c = 0; c < numChannels; ++c) axis[c] *= inverseLength;
+        }
+    }
+
+    /// find the extremes of the pixels projected onto the principal axis, clamped to the [0, 255] range
+    void computeEndPoints(const PixelBlock& pixels, int numChannels, float start[4], float end[4])
+    {
+        float mean[4], axis[4];
+        computePrincipalAxis(pixels, numChannels, mean, axis);
+
+        float minT = 0.0f, maxT = 0.0f;
+        for (auto& p : pixels)
+        {
+            float t = 0.0f;
+            for (int c = 0; c < numChannels; ++c) t += (p[c] - mean[c]) * axis[c];
+            minT = std::min(minT, t);
+            maxT = std::max(maxT, t);
+        }
+
+        for (int c = 0; c < 4; ++c)
+        {
+            start[c] = std::clamp(mean[c] + axis[c] * minT, 0.0f, 255.0f);
+            end[c] = std::clamp(mean[c] + axis[c] * maxT, 0.0f, 255.0f);
+        }
+    }
+
+    uint16_t encode565(const float color[3])
+    {
+        auto r = static_cast<uint16_t>(std::clamp(color[0], 0.0f, 255.0f) * (31.0f / 255.0f) + 0.5f);
+        auto g = static_cast<uint16_t>(std::clamp(color[1], 0.0f, 255.0f) * (63.0f / 255.0f) + 0.5f);
+        auto b = static_cast<uint16_t>(std::clamp(color[2], 0.0f, 255.0f) * (31.0f / 255.0f) + 0.5f);
+        return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+    }
+
+    void decode565(uint16_t value, float color[3])
+    {
+        uint32_t r = (value >> 11) & 31;
+        uint32_t g = (value >> 5) & 63;
+        uint32_t b = value & 31;
+        color[0] = static_cast<float>((r << 3) | (r >> 2));
+        color[1] = static_cast<float>((g << 2) | (g >> 4));
+        color[2] = static_cast<float>((b << 3) | (b >> 2));
+    }
+
+    /// select the nearest of the 4 palette colors for each pixel, returning the total squared error
+    float selectColorIndices(const PixelBlock& pixels, uint16_t c0, uint16_t c1, uint8_t indices[16])
+    {
+        float palette[4][3];
+        decode565(c0, palette[0]);
+        decode565(c1, palette[1]);
+        for (int c = 0; c < 3; ++c)
+        {
+            palette[2][c] = (2.0f * palette[0][c] + palette[1][c]) / 3.0f;
+            palette[3][c] = (palette[0][c] + 2.0f * palette[1][c]) / 3.0f;
+        }
+
+        float totalError = 0.0f;
+        for (int i = 0; i < 16; ++i)
+        {
+            float bestError = std::numeric_limits<float>::max();
+            for (uint8_t p = 0; p < 4; ++p)
+            {
+                float error = 0.0f;
+                for (int c = 0; c < 3; ++c)
+                {
+                    float delta = pixels[i][c] - palette[p][c];
+                    error += delta * delta;
+                }
+                if (error < bestError)
+                {
+                    bestError = error;
+                    indices[i] = p;
+                }
+            }
+            totalError += bestError;
+        }
+        return totalError;
+    }
+
+    /// least squares fit of the two end points given the palette index selected for each pixel
+    bool refitColorEndPoints(const PixelBlock& pixels, const uint8_t indices[16], float start[3], float end[3])
+    {
+        static const float weights[4] = {0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+
+        float aa = 0.0f, bb = 0.0f, ab = 0.0f;
+        float ax[3] = {0.0f, 0.0f, 0.0f};
+        float bx[3] = {0.0f, 0.0f, 0.0f};
+        for (int i = 0; i < 16; ++i)
+        {
+            float b = weights[indices[i]];
+            float a = 1.0f - b;
+            aa += a * a;
+            bb += b * b;
+            ab += a * b;
+            for (int c = 0; c < 3; ++c)
+            {
+                ax[c] += a * pixels[i][c];
+                bx[c] += b * pixels[i][c];
+            }
+        }
+
+        float determinant = aa * bb - ab * ab;
+        if (std::abs(determinant) < 1e-6f) return false;
+
+        float inverseDeterminant = 1.0f / determinant;
+        for (int c = 0; c < 3; ++c)
+        {
+            start[c] = (ax[c] * bb - bx[c] * ab) * inverseDeterminant;
+            end[c] = (bx[c] * aa - ax[c] * ab) * inverseDeterminant;
+        }
+        return true;
+    }
+
+    /// encode the RGB channels of a block as a BC1 color block, always using the 4 color mode so that the block is also valid for BC3
+    void encodeColorBlock(const PixelBlock& pixels, uint8_t* output)
+    {
+        float start[4], end[4];
+        computeEndPoints(pixels, 3, start, end);
+
+        uint16_t c0 = encode565(end);
+        uint16_t c1 = encode565(start);
+        if (c0 < c1) std::swap(c0, c1);
+
+        uint8_t indices[16] = {};
+        if (c0 != c1)
+        {
+            float error = selectColorIndices(pixels, c0, c1, indices);
+
+            // refine the end points using the selected indices, keeping them if they reduce the error
+            float refinedStart[3], refinedEnd[3];
+            if (refitColorEndPoints(pixels, indices, refinedStart, refinedEnd))
+            {
+                uint16_t r0 = encode565(refinedStart);
+                uint16_t r1 = encode565(refinedEnd);
+                if (r0 < r1) std::swap(r0, r1);
+                if (r0 != r1)
+                {
+                    uint8_t refinedIndices[16];
+                    if (selectColorIndices(pixels, r0, r1, refinedIndices) < error)
+                    {
+                        c0 = r0;
+                        c1 = r1;
+                        std::memcpy(indices, refinedIndices, sizeof(indices));
+                    }
+                }
+            }
+        }
+
+        uint32_t packedIndices = 0;
+        for (int i = 0; i < 16; ++i) packedIndices |= static_cast<uint32_t>(indices[i]) << (i * 2);
+
+        output[0] = static_cast<uint8_t>(c0 & 0xff);
+        output[1] = static_cast<uint8_t>(c0 >> 8);
+        output[2] = static_cast<uint8_t>(c1 & 0xff);
+        output[3] = static_cast<uint8_t>(c1 >> 8);
+        for (int i = 0; i < 4; ++i) output[4 + i] = static_cast<uint8_t>(packedIndices >> (i * 8));
+    }
+
+    /// encode the alpha channel of a block as a BC3 alpha block, using the 8 value interpolation mode
+    void encodeAlphaBlock(const PixelBlock& pixels, uint8_t* output)
+    {
+        float minAlpha = 255.0f, maxAlpha = 0.0f;
+        for (auto& p : pixels)
+        {
+            minAlpha = std::min(minAlpha, p[3]);
+            maxAlpha = std::max(maxAlpha, p[3]);
+        }
+
+        auto a0 = static_cast<uint8_t>(maxAlpha + 0.5f);
+        auto a1 = static_cast<uint8_t>(minAlpha + 0.5f);
+
+        uint64_t packedIndices = 0;
+        if (a0 != a1)
+        {
+            float palette[8];
+            palette[0] = a0;
+            palette[1] = a1;
+            for (int i = 1; i < 7; ++i) palette[i + 1] = static_cast<float>(((7 - i) * a0 + i * a1) / 7);
+
+            for (int i = 0; i < 16; ++i)
+            {
+                uint64_t bestIndex = 0;
+                float bestError = std::numeric_limits<float>::max();
+                for (uint64_t p = 0; p < 8; ++p)
+                {
+                    float error = std::abs(pixels[i][3] - palette[p]);
+                    if (error < bestError)
+                    {
+                        bestError = error;
+                        bestIndex = p;
+                    }
+                }
+                packedIndices |= bestIndex << (i * 3);
+            }
+        }
+
+        output[0] = a0;
+        output[1] = a1;
+        for (int i = 0; i < 6; ++i) output[2 + i] = static_cast<uint8_t>(packedIndices >> (i * 8));
+    }
+
+    /// writes bits into a zero initialized block, least significant bit first
+    struct BitWriter
+    {
+        uint8_t* bytes;
+        uint32_t position = 0;
+
+        void write(uint32_t value, uint32_t numBits)
+        {
+            for (uint32_t i = 0; i < numBits; ++i, ++position)
+            {
+                if ((value >> i) & 1) bytes[position >> 3] |= static_cast<uint8_t>(1 << (position & 7));
+            }
+        }
+    };
+
+    /// quantize an RGBA end point to the 7 bits per channel plus shared p-bit of BC7 mode 6, choosing the p-bit with the lower error
+    void quantizeMode6EndPoint(const float endPoint[4], uint32_t quantized[4], uint32_t& pbit)
+    {
+        float bestError = std::numeric_limits<float>::max();
+        for (uint32_t p = 0; p < 2; ++p)
+        {
+            float error = 0.0f;
+            uint32_t values[4];
+            for (int c = 0; c < 4; ++c)
+            {
+                values[c] = static_cast<uint32_t>(std::clamp((endPoint[c] - static_cast<float>(p)) * 0.5f + 0.5f, 0.0f, 127.0f));
+                float delta = endPoint[c] - static_cast<float>((values[c] << 1) | p);
+                error += delta * delta;
+            }
+            if (error < bestError)
+            {
+                bestError = error;
+                pbit = p;
+                for (int c = 0; c < 4; ++c) quantized[c] = values[c];
+            }
+        }
+    }
+
+    /// encode an RGBA block as a BC7 mode 6 block, a single subset with 7.7.7.7 + p-bit end points and 4 bit indices
+    void encodeBC7Block(const PixelBlock& pixels, uint8_t* output)
+    {
+        static const uint32_t weights[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+        float start[4], end[4];
+        computeEndPoints(pixels, 4, start, end);
+
+        uint32_t e0[4], e1[4], p0 = 0, p1 = 0;
+        quantizeMode6EndPoint(start, e0, p0);
+        quantizeMode6EndPoint(end, e1, p1);
+
+        float palette[16][4];
+        for (int i = 0; i < 16; ++i)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                uint32_t v0 = (e0[c] << 1) | p0;
+                uint32_t v1 = (e1[c] << 1) | p1;
+                palette[i][c] = static_cast<float>(((64 - weights[i]) * v0 + weights[i] * v1 + 32) >> 6);
+            }
+        }
+
+        uint32_t indices[16];
+        for (int i = 0; i < 16; ++i)
+        {
+            float bestError = std::numeric_limits<float>::max();
+            for (uint32_t p = 0; p < 16; ++p)
+            {
+                float error = 0.0f;
+                for (int c = 0; c < 4; ++c)
+                {
+                    float delta = pixels[i][c] - palette[p][c];
+                    error += delta * delta;
+                }
+                if (error < bestError)
+                {
+                    bestError = error;
+                    indices[i] = p;
+                }
+            }
+        }
+
+        // the most significant bit of the first index is implicitly zero, so swap the end points if required
+        if (indices[0] >= 8)
+        {
+            for (int c = 0; c < 4; ++c) std::swap(e0[c], e1[c]);
+            std::swap(p0, p1);
+            for (auto& index : indices) index = 15 - index;
+        }
+
+        std::memset(output, 0, 16);
+        BitWriter writer{output};
+        writer.write(1 << 6, 7); // mode 6
+        for (int c = 0; c < 4; ++c)
+        {
+            writer.write(e0[c], 7);
+            writer.write(e1[c], 7);
+        }
+        writer.write(p0, 1);
+        writer.write(p1, 1);
+        writer.write(indices[0], 3);
+        for (int i = 1; i < 16; ++i) writer.write(indices[i], 4);
+    }
+
+    /// compress one mipmap level, processing block rows [begin, end)
+    template<typename T>
+    void compressBlockRows(const ubvec4Array2D& source, size_t sourceOffset, uint32_t sourceWidth, uint32_t sourceHeight, T* dest, uint32_t blocksWide, uint32_t begin, uint32_t end, bool bgra, BlockCompression compression)
+    {
+        PixelBlock pixels;
+        for (uint32_t by = begin; by < end; ++by)
+        {
+            for (uint32_t bx = 0; bx < blocksWide; ++bx)
+            {
+                // gather the block's pixels, replicating the edge pixels of levels that don't fill the block
+                for (uint32_t j = 0; j < 4; ++j)
+                {
+                    uint32_t y = std::min(by * 4 + j, sourceHeight - 1);
+                    for (uint32_t i = 0; i < 4; ++i)
+                    {
+                        uint32_t x = std::min(bx * 4 + i, sourceWidth - 1);
+                        const ubvec4& p = *source.data(sourceOffset + static_cast<size_t>(y) * sourceWidth + x);
+                        auto& pixel = pixels[j * 4 + i];
+                        pixel[0] = bgra ? p[2] : p[0];
+                        pixel[1] = p[1];
+                        pixel[2] = bgra ? p[0] : p[2];
+                        pixel[3] = p[3];
+                    }
+                }
+
+                uint8_t* output = dest[static_cast<size_t>(by) * blocksWide + bx].value;
+                switch (compression)
+                {
+                case (BlockCompression::BC1):
+                    encodeColorBlock(pixels, output);
+                    break;
+                case (BlockCompression::BC3):
+                    encodeAlphaBlock(pixels, output);
+                    encodeColorBlock(pixels, output + 8);
+                    break;
+                case (BlockCompression::BC7):
+                    encodeBC7Block(pixels, output);
+                    break;
+                }
+            }
+        }
+    }
+
+    template<class A>
+    ref_ptr<Data> compress(const ubvec4Array2D& source, bool srgb, bool bgra, BlockCompression compression, OperationThreads* operationThreads)
+    {
+        uint32_t width = source.width();
+        uint32_t height = source.height();
+        uint32_t blocksWide = (width + 3) / 4;
+        uint32_t blocksHigh = (height + 3) / 4;
+
+        auto sourceOffsets = source.computeMipmapOffsets();
+        if (sourceOffsets.empty()) sourceOffsets.push_back(0);
+
+        // the Data mipmap layout halves the number of blocks for each level, so only keep the levels whose pixel dimensions
+        // still round up to that number of blocks, dropping levels smaller than a block and those of non power of two images
+        uint32_t numLevels = 1;
+        for (uint32_t w = width, h = height, bw = blocksWide, bh = blocksHigh; numLevels < sourceOffsets.size() && (bw > 1 || bh > 1); ++numLevels)
+        {
+            w = std::max(w / 2, 1u);
+            h = std::max(h / 2, 1u);
+            bw = std::max(bw / 2, 1u);
+            bh = std::max(bh / 2, 1u);
+            if ((w + 3) / 4 != bw || (h + 3) / 4 != bh) break;
+        }
+
+        auto properties = source.properties;
+        properties.blockWidth = 4;
+        properties.blockHeight = 4;
+        properties.blockDepth = 1;
+        properties.maxNumMipmaps = static_cast<uint8_t>(numLevels);
+        switch (compression)
+        {
+        case (BlockCompression::BC1): properties.format = srgb ? VK_FORMAT_BC1_RGB_SRGB_BLOCK : VK_FORMAT_BC1_RGB_UNORM_BLOCK; break;
+        case (BlockCompression::BC3): properties.format = srgb ? VK_FORMAT_BC3_SRGB_BLOCK : VK_FORMAT_BC3_UNORM_BLOCK; break;
+        case (BlockCompression::BC7): properties.format = srgb ? VK_FORMAT_BC7_SRGB_BLOCK : VK_FORMAT_BC7_UNORM_BLOCK; break;
+        }
+
+        auto compressed = createMipmappedArray<A>(blocksWide, blocksHigh, properties);
+        auto destOffsets = compressed->computeMipmapOffsets();
+        if (destOffsets.empty()) destOffsets.push_back(0);
+
+        uint32_t levelWidth = width, levelHeight = height;
+        uint32_t levelBlocksWide = blocksWide, levelBlocksHigh = blocksHigh;
+        for (uint32_t level = 0; level < numLevels; ++level)
+        {
+            auto dest = compressed->data(destOffsets[level]);
+            size_t sourceOffset = sourceOffsets[level];
+            parallelFor(threadsForWorkload(operationThreads, static_cast<size_t>(levelBlocksWide) * levelBlocksHigh * 16), levelBlocksHigh, [&](uint32_t begin, uint32_t end) {
+                compressBlockRows(source, sourceOffset, levelWidth, levelHeight, dest, levelBlocksWide, begin, end, bgra, compression);
+            });
+
+            if (levelWidth > 1) levelWidth /= 2;
+            if (levelHeight > 1) levelHeight /= 2;
+            if (levelBlocksWide > 1) levelBlocksWide /= 2;
+            if (levelBlocksHigh > 1) levelBlocksHigh /= 2;
+        }
+
+        return compressed;
+    }
+} // namespace
+
+ref_ptr<Data> vsg::generateMipmaps(ref_ptr<const Data> image, OperationThreads* operationThreads)
+{
+    bool srgb = false, bgra = false;
+    auto source = image ? image->cast<ubvec4Array2D>() : nullptr;
+    if (!source || !supportedFormat(source->properties.format, srgb, bgra)) return {};
+
+    uint32_t width = source->width();
+    uint32_t height = source->height();
+
+    auto properties = source->properties;
+    properties.maxNumMipmaps = static_cast<uint8_t>(computeNumLevels(width, height));
+
+    auto mipmaps = createMipmappedArray<ubvec4Array2D>(width, height, properties);
+
+    // copy the base level, the source may be a strided view or already have mipmaps
+    ubvec4* dest = mipmaps->data();
+    for (uint32_t j = 0; j < height; ++j)
+    {
+        for (uint32_t i = 0; i < width; ++i) *(dest++) = source->at(i, j);
+    }
+
+    auto offsets = mipmaps->computeMipmapOffsets();
+    uint32_t levelWidth = width, levelHeight = height;
+    for (size_t level = 1; level < offsets.size(); ++level)
+    {
+        uint32_t nextWidth = std::max(levelWidth / 2, 1u);
+        uint32_t nextHeight = std::max(levelHeight / 2, 1u);
+
+        const ubvec4* sourceLevel = mipmaps->data(offsets[level - 1]);
+        ubvec4* destLevel = mipmaps->data(offsets[level]);
+        parallelFor(threadsForWorkload(operationThreads, static_cast<size_t>(nextWidth) * nextHeight), nextHeight, [&](uint32_t begin, uint32_t end) {
+            downsampleRows(sourceLevel, levelWidth, levelHeight, destLevel, nextWidth, begin, end, srgb);
+        });
+
+        levelWidth = nextWidth;
+        levelHeight = nextHeight;
+    }
+
+    return mipmaps;
+}
+
+ref_ptr<Data> vsg::compressImage(ref_ptr<const Data> image, BlockCompression compression, OperationThreads* operationThreads)
+{
+    bool srgb = false, bgra = false;
+    auto source = image ? image->cast<ubvec4Array2D>() : nullptr;
+    if (!source || !supportedFormat(source->properties.format, srgb, bgra)) return {};
+
+    if (compression == BlockCompression::BC1)
+        return compress<block64Array2D>(*source, srgb, bgra, compression, operationThreads);
+    else
+        return compress<block128Array2D>(*source, srgb, bgra, compression, operationThreads);
+}
@@ -10,6 +10,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/maths/transform.h>
 #include <vsg/nodes/Transform.h>
 #include <vsg/utils/LineSegmentIntersector.h>
 
@@ -21,6 +22,9 @@ struct TriangleIntersector
     using value_type = V;
     using vec_type = t_vec3<value_type>;
 
+    dvec3 lineStart;
+    dvec3 lineEnd;
+
     dvec3 start;
     dvec3 end;
     uint32_t instanceIndex = 0;
@@ -36,12 +40,36 @@ struct TriangleIntersector
     LineSegmentIntersector& intersector;
     ref_ptr<const vec3Array> vertices;
 
-    TriangleIntersector(LineSegmentIntersector& in_intersector, const dvec3& in_start, const dvec3& in_end, ref_ptr<const vec3Array> in_vertices) :
-        start(in_start),
-        end(in_end),
-        intersector(in_intersector),
-        vertices(in_vertices)
+    bool useInstanceMatrix = false;
+    dmat4 instanceMatrix;
+
+    TriangleIntersector(LineSegmentIntersector& in_intersector, const dvec3& in_start, const dvec3& in_end) :
+        lineStart(in_start),
+        lineEnd(in_end),
+        intersector(in_intersector)
+    {
+    }
+
+    /// set up the vertices and line segment for the specified instance, returning false if no vertices are available
+    bool instance(ArrayState& arrayState, uint32_t index)
     {
+        instanceIndex = index;
+
+        // when the instance is an affine transform of the vertices, transform the line segment into the instance's frame rather than copying the vertices
+        useInstanceMatrix = arrayState.instanceMatrix(index, instanceMatrix);
+        if (useInstanceMatrix)
+        {
+            dmat4 inverseInstanceMatrix = inverse(instanceMatrix);
+            vertices = arrayState.vertices;
+            start = inverseInstanceMatrix * lineStart;
+            end = inverseInstanceMatrix * lineEnd;
+        }
+        else
+        {
+            vertices = arrayState.vertexArray(index);
+            start = lineStart;
+            end = lineEnd;
+        }
 
         _d = end - start;
         _length = length(_d);
@@ -51,6 +79,8 @@ struct TriangleIntersector
         _d_invX = _d.x != 0.0 ? _d / _d.x : vec_type(0.0, 0.0, 0.0);
         _d_invY = _d.y != 0.0 ? _d / _d.y : vec_type(0.0, 0.0, 0.0);
         _d_invZ = _d.z != 0.0 ? _d / _d.z : vec_type(0.0, 0.0, 0.0);
+
+        return vertices.valid();
     }
 
     /// intersect with a single triangle
@@ -123,6 +153,8 @@ struct TriangleIntersector
         }
 
         dvec3 intersection = dvec3(dvec3(v0) * double(r0) + dvec3(v1) * double(r1) + dvec3(v2) * double(r2));
+        if (useInstanceMatrix) intersection = instanceMatrix * intersection;
+
         intersector.add(intersection, double(r), {{i0, r0}, {i1, r1}, {i2, r2}}, instanceIndex);
 
         return true;
@@ -252,11 +284,12 @@ bool LineSegmentIntersector::intersectDraw(uint32_t firstVertex, uint32_t vertex
     const auto& ls = _lineSegmentStack.back();
 
     size_t previous_size = intersections.size();
+    TriangleIntersector<double> triIntersector(*this, ls.start, ls.end);
+
     uint32_t lastIndex = instanceCount > 1 ? (firstInstance + instanceCount) : firstInstance + 1;
     for (uint32_t instanceIndex = firstInstance; instanceIndex < lastIndex; ++instanceIndex)
     {
-        TriangleIntersector<double> triIntersector(*this, ls.start, ls.end, arrayState.vertexArray(instanceIndex));
-        if (!triIntersector.vertices) return false;
+        if (!triIntersector.instance(arrayState, instanceIndex)) return false;
 
         uint32_t endVertex = int((firstVertex + vertexCount) / 3.0f) * 3;
 
@@ -277,13 +310,12 @@ bool LineSegmentIntersector::intersectDrawIndexed(uint32_t firstIndex, uint32_t
     const auto& ls = _lineSegmentStack.back();
 
     size_t previous_size = intersections.size();
+    TriangleIntersector<double> triIntersector(*this, ls.start, ls.end);
+
     uint32_t lastIndex = instanceCount > 1 ? (firstInstance + instanceCount) : firstInstance + 1;
     for (uint32_t instanceIndex = firstInstance; instanceIndex < lastIndex; ++instanceIndex)
     {
-        TriangleIntersector<double> triIntersector(*this, ls.start, ls.end, arrayState.vertexArray(instanceIndex));
-        if (!triIntersector.vertices) continue;
-
-        triIntersector.instanceIndex = instanceIndex;
+        if (!triIntersector.instance(arrayState, instanceIndex)) continue;
 
         uint32_t endIndex = int((firstIndex + indexCount) / 3.0f) * 3;
 
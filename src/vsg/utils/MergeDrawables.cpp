@@ -0,0 +1,453 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/commands/DrawIndexed.h>
+#include <vsg/core/compare.h>
+#include <vsg/maths/transform.h>
+#include <vsg/nodes/CullNode.h>
+#include <vsg/nodes/Geometry.h>
+#include <vsg/nodes/MatrixTransform.h>
+#include <vsg/nodes/StateGroup.h>
+#include <vsg/nodes/VertexIndexDraw.h>
+#include <vsg/utils/MergeDrawables.h>
+
+#include <algorithm>
+#include <map>
+#include <typeindex>
+
+using namespace vsg;
+
+namespace
+{
+    // create a contiguous array of the same type and format as prototype, return null for types that MergeDrawables doesn't support
+    ref_ptr<Data> createArrayLike(const Data& prototype, uint32_t size)
+    {
+        auto properties = prototype.properties;
+        properties.stride = 0;
+
+        if (prototype.cast<vec3Array>()) return vec3Array::create(size, properties);
+        if (prototype.cast<vec2Array>()) return vec2Array::create(size, properties);
+        if (prototype.cast<vec4Array>()) return vec4Array::create(size, properties);
+        if (prototype.cast<ubvec4Array>()) return ubvec4Array::create(size, properties);
+        if (prototype.cast<floatArray>()) return floatArray::create(size, properties);
+        return {};
+    }
+
+    // copy the values at sourceIndices to consecutive entries of dest, starting at offset
+    template<class A>
+    bool copyValues(const Data& src, const std::vector<uint32_t>& sourceIndices, Data& dest, uint32_t offset)
+    {
+        auto src_array = src.cast<A>();
+        auto dest_array = dest.cast<A>();
+        if (!src_array || !dest_array) return false;
+
+        for (size_t i = 0; i < sourceIndices.size(); ++i)
+        {
+            dest_array->set(offset + static_cast<uint32_t>(i), src_array->at(sourceIndices[i]));
+        }
+        return true;
+    }
+
+    bool copyValues(const Data& src, const std::vector<uint32_t>& sourceIndices, Data& dest, uint32_t offset)
+    {
+        return copyValues<vec3Array>(src, sourceIndices, dest, offset) ||
+               copyValues<vec2Array>(src, sourceIndices, dest, offset) ||
+               copyValues<vec4Array>(src, sourceIndices, dest, offset) ||
+               copyValues<ubvec4Array>(src, sourceIndices, dest, offset) ||
+               copyValues<floatArray>(src, sourceIndices, dest, offset);
+    }
+
+    uint32_t indexValue(const Data& indices, uint32_t i)
+    {
+        if (auto ushort_indices = indices.cast<ushortArray>()) return ushort_indices->at(i);
+        return static_cast<const uintArray&>(indices).at(i);
+    }
+
+    uint64_t mortonCode(const dvec3& position, const dbox& extents)
+    {
+        uint64_t code = 0;
+        dvec3 size = extents.max - extents.min;
+        uint64_t xyz[3];
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            double ratio = size[axis] > 0.0 ? (position[axis] - extents.min[axis]) / size[axis] : 0.0;
+            xyz[axis] = static_cast<uint64_t>(std::clamp(ratio, 0.0, 1.0) * 1023.0);
+        }
+        for (int bit = 9; bit >= 0; --bit)
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                code = (code << 1) | ((xyz[axis] >> bit) & 1);
+            }
+        }
+        return code;
+    }
+} // namespace
+
+struct MergeDrawables::Drawable
+{
+    size_t childIndex = 0;
+    uint32_t firstBinding = 0;
+    DataList arrays;
+    ref_ptr<Data> indices;
+    uint32_t indexCount = 0;
+    uint32_t firstIndex = 0;
+    uint32_t vertexOffset = 0;
+    uint32_t vertexCount = 0;
+    std::vector<uint32_t> sourceVertices; // sorted source vertices referenced by the indices, so drawables sharing arrays only copy the vertices they use
+    const dmat4* matrix = nullptr;
+    dbox bounds;
+    uint64_t mortonCode = 0;
+};
+
+MergeDrawables::MergeDrawables()
+{
+}
+
+void MergeDrawables::apply(Object& object)
+{
+    object.traverse(*this);
+}
+
+void MergeDrawables::apply(Group& group)
+{
+    if (_visited.count(&group) != 0) return;
+    _visited.insert(&group);
+
+    if (mergeStateGroups) _mergeStateGroups(group);
+
+    group.traverse(*this);
+
+    _mergeDrawables(group);
+}
+
+void MergeDrawables::_mergeStateGroups(Group& group)
+{
+    Group::Children children;
+    children.reserve(group.children.size());
+
+    std::vector<StateGroup*> candidates;
+    std::set<StateGroup*> created;
+    for (auto& child : group.children)
+    {
+        auto stateGroup = (child && child->type_info() == typeid(StateGroup)) ? static_cast<StateGroup*>(child.get()) : nullptr;
+        if (!stateGroup)
+        {
+            children.push_back(child);
+            continue;
+        }
+
+        size_t i = 0;
+        for (; i < candidates.size(); ++i)
+        {
+            if (candidates[i]->prototypeArrayState == stateGroup->prototypeArrayState && compare_pointer_container(candidates[i]->stateCommands, stateGroup->stateCommands) == 0) break;
+        }
+
+        if (i == candidates.size())
+        {
+            candidates.push_back(stateGroup);
+            children.push_back(child);
+            continue;
+        }
+
+        // replace the first StateGroup with a new one so that StateGroups shared with other parents aren't modified
+        auto& first = candidates[i];
+        if (created.count(first) == 0)
+        {
+            auto merged = StateGroup::create();
+            merged->stateCommands = first->stateCommands;
+            merged->prototypeArrayState = first->prototypeArrayState;
+            merged->children = first->children;
+
+            std::replace(children.begin(), children.end(), ref_ptr<Node>(first), ref_ptr<Node>(merged));
+            first = merged.get();
+            created.insert(first);
+        }
+
+        first->children.insert(first->children.end(), stateGroup->children.begin(), stateGroup->children.end());
+        ++numStateGroupsMerged;
+    }
+
+    group.children.swap(children);
+}
+
+bool MergeDrawables::_collect(Node* node, const dmat4* matrix, std::vector<Drawable>& drawables)
+{
+    Drawable drawable;
+    BufferInfoList* arrays = nullptr;
+    ref_ptr<BufferInfo> indices;
+
+    if (auto vid = node->cast<VertexIndexDraw>())
+    {
+        if (vid->instanceCount != 1 || vid->firstInstance != 0) return false;
+        arrays = &vid->arrays;
+        indices = vid->indices;
+        drawable.firstBinding = vid->firstBinding;
+        drawable.indexCount = vid->indexCount;
+        drawable.firstIndex = vid->firstIndex;
+        drawable.vertexOffset = vid->vertexOffset;
+    }
+    else if (auto geometry = node->cast<Geometry>())
+    {
+        if (geometry->commands.size() != 1) return false;
+        auto drawIndexed = geometry->commands.front()->cast<DrawIndexed>();
+        if (!drawIndexed || drawIndexed->instanceCount != 1 || drawIndexed->firstInstance != 0) return false;
+        arrays = &geometry->arrays;
+        indices = geometry->indices;
+        drawable.firstBinding = geometry->firstBinding;
+        drawable.indexCount = drawIndexed->indexCount;
+        drawable.firstIndex = drawIndexed->firstIndex;
+        drawable.vertexOffset = drawIndexed->vertexOffset;
+    }
+    else if (auto cullNode = node->cast<CullNode>())
+    {
+        // the merged drawable's CullNode takes over the culling
+        return cullNode->child && _collect(cullNode->child, matrix, drawables);
+    }
+    else if (auto transform = node->cast<MatrixTransform>(); transform && bakeTransforms && !matrix)
+    {
+        size_t previousSize = drawables.size();
+        for (auto& child : transform->children)
+        {
+            if (!child || !_collect(child, &transform->matrix, drawables))
+            {
+                drawables.resize(previousSize);
+                return false;
+            }
+        }
+        return drawables.size() > previousSize;
+    }
+    else
+    {
+        return false;
+    }
+
+    if (!indices || !indices->data || indices->data->dynamic() || arrays->empty() || drawable.indexCount == 0) return false;
+    if (!indices->data->cast<ushortArray>() && !indices->data->cast<uintArray>()) return false;
+    if (drawable.firstIndex + drawable.indexCount > indices->data->valueCount()) return false;
+
+    auto vertices = (*arrays)[0] ? (*arrays)[0]->data.cast<vec3Array>() : ref_ptr<vec3Array>();
+    if (!vertices) return false;
+    uint32_t arraySize = vertices->size();
+
+    for (auto& bufferInfo : *arrays)
+    {
+        if (!bufferInfo || !bufferInfo->data || bufferInfo->data->dynamic() || bufferInfo->data->valueCount() != arraySize) return false;
+        if (!createArrayLike(*bufferInfo->data, 0)) return false;
+        drawable.arrays.push_back(bufferInfo->data);
+    }
+
+    drawable.indices = indices->data;
+    drawable.matrix = matrix;
+    for (uint32_t i = drawable.firstIndex; i < drawable.firstIndex + drawable.indexCount; ++i)
+    {
+        uint32_t index = indexValue(*drawable.indices, i) + drawable.vertexOffset;
+        if (index >= arraySize) return false;
+
+        drawable.sourceVertices.push_back(index);
+    }
+
+    std::sort(drawable.sourceVertices.begin(), drawable.sourceVertices.end());
+    drawable.sourceVertices.erase(std::unique(drawable.sourceVertices.begin(), drawable.sourceVertices.end()), drawable.sourceVertices.end());
+    drawable.vertexCount = static_cast<uint32_t>(drawable.sourceVertices.size());
+
+    for (auto index : drawable.sourceVertices)
+    {
+        dvec3 v(vertices->at(index));
+        drawable.bounds.add(matrix ? (*matrix * v) : v);
+    }
+
+    drawables.push_back(drawable);
+    return true;
+}
+
+void MergeDrawables::_mergeDrawables(Group& group)
+{
+    std::vector<Drawable> drawables;
+    for (size_t i = 0; i < group.children.size(); ++i)
+    {
+        auto& child = group.children[i];
+        if (!child) continue;
+
+        size_t previousSize = drawables.size();
+        if (_collect(child, nullptr, drawables))
+        {
+            for (size_t d = previousSize; d < drawables.size(); ++d) drawables[d].childIndex = i;
+        }
+    }
+
+    if (drawables.empty()) return;
+
+    // group drawables with the same vertex layout
+    using ArrayLayouts = std::vector<std::pair<std::type_index, uint32_t>>;
+    using LayoutKey = std::pair<uint32_t, ArrayLayouts>;
+    std::map<LayoutKey, std::vector<Drawable*>> layouts;
+    for (auto& drawable : drawables)
+    {
+        LayoutKey key;
+        key.first = drawable.firstBinding;
+        for (auto& array : drawable.arrays) key.second.emplace_back(array->type_info(), static_cast<uint32_t>(array->properties.format));
+        layouts[key].push_back(&drawable);
+    }
+
+    std::set<size_t> mergedChildren;
+    std::map<size_t, Group::Children> insertions;
+
+    for (auto& [key, layoutDrawables] : layouts)
+    {
+        // sort spatially so that each batch is compact, keeping culling effective
+        dbox extents;
+        for (auto& drawable : layoutDrawables) extents.add(drawable->bounds);
+        for (auto& drawable : layoutDrawables) drawable->mortonCode = mortonCode((drawable->bounds.min + drawable->bounds.max) * 0.5, extents);
+        std::stable_sort(layoutDrawables.begin(), layoutDrawables.end(), [](const Drawable* lhs, const Drawable* rhs) { return lhs->mortonCode < rhs->mortonCode; });
+
+        std::vector<Drawable*> batch;
+        uint32_t batchVertexCount = 0;
+
+        auto mergeBatch = [&]() {
+            // leave a lone drawable unchanged unless it has a transform to bake, drawables with transforms are always merged so their MatrixTransform can be removed
+            if (batch.size() == 1 && !batch.front()->matrix)
+            {
+                batch.clear();
+                return;
+            }
+            if (batch.empty()) return;
+
+            auto merged = _merge(batch);
+            if (merged)
+            {
+                size_t childIndex = batch.front()->childIndex;
+                for (auto& drawable : batch)
+                {
+                    mergedChildren.insert(drawable->childIndex);
+                    childIndex = std::min(childIndex, drawable->childIndex);
+                }
+                insertions[childIndex].push_back(merged);
+            }
+            batch.clear();
+        };
+
+        for (auto& drawable : layoutDrawables)
+        {
+            if (!batch.empty() && batchVertexCount + drawable->vertexCount > maxVerticesPerBatch)
+            {
+                mergeBatch();
+                batchVertexCount = 0;
+            }
+            batch.push_back(drawable);
+            batchVertexCount += drawable->vertexCount;
+        }
+        mergeBatch();
+    }
+
+    if (mergedChildren.empty()) return;
+
+    Group::Children children;
+    for (size_t i = 0; i < group.children.size(); ++i)
+    {
+        if (auto itr = insertions.find(i); itr != insertions.end())
+        {
+            children.insert(children.end(), itr->second.begin(), itr->second.end());
+        }
+        if (mergedChildren.count(i) == 0) children.push_back(group.children[i]);
+    }
+    group.children.swap(children);
+}
+
+ref_ptr<Node> MergeDrawables::_merge(std::vector<Drawable*>& batch)
+{
+    uint32_t vertexCount = 0;
+    uint32_t indexCount = 0;
+    for (auto& drawable : batch)
+    {
+        vertexCount += drawable->vertexCount;
+        indexCount += drawable->indexCount;
+    }
+
+    const auto& prototype = *batch.front();
+
+    DataList arrays;
+    for (auto& array : prototype.arrays)
+    {
+        arrays.push_back(createArrayLike(*array, vertexCount));
+    }
+
+    ref_ptr<Data> indices;
+    if (vertexCount > 65536)
+        indices = uintArray::create(indexCount);
+    else
+        indices = ushortArray::create(indexCount);
+
+    auto ushort_indices = indices.cast<ushortArray>();
+    auto uint_indices = indices.cast<uintArray>();
+
+    dbox bounds;
+    uint32_t baseVertex = 0;
+    uint32_t baseIndex = 0;
+    for (auto& drawable : batch)
+    {
+        for (size_t a = 0; a < arrays.size(); ++a)
+        {
+            copyValues(*drawable->arrays[a], drawable->sourceVertices, *arrays[a], baseVertex);
+        }
+
+        if (drawable->matrix)
+        {
+            const auto& matrix = *drawable->matrix;
+            auto& vertices = static_cast<vec3Array&>(*arrays[0]);
+            for (uint32_t i = baseVertex; i < baseVertex + drawable->vertexCount; ++i)
+            {
+                vertices[i] = vec3(matrix * dvec3(vertices[i]));
+            }
+
+            if (auto normals = arrays.size() > 1 ? arrays[1].cast<vec3Array>() : ref_ptr<vec3Array>())
+            {
+                auto inverse = inverse_3x3(matrix);
+                for (uint32_t i = baseVertex; i < baseVertex + drawable->vertexCount; ++i)
+                {
+                    dvec3 n(normals->at(i));
+                    normals->set(i, vec3(normalize(dvec3(dot(inverse[0], n), dot(inverse[1], n), dot(inverse[2], n)))));
+                }
+            }
+        }
+
+        for (uint32_t i = 0; i < drawable->indexCount; ++i)
+        {
+            uint32_t sourceIndex = indexValue(*drawable->indices, drawable->firstIndex + i) + drawable->vertexOffset;
+            auto itr = std::lower_bound(drawable->sourceVertices.begin(), drawable->sourceVertices.end(), sourceIndex);
+            uint32_t index = static_cast<uint32_t>(itr - drawable->sourceVertices.begin()) + baseVertex;
+            if (ushort_indices)
+                ushort_indices->set(baseIndex + i, static_cast<uint16_t>(index));
+            else
+                uint_indices->set(baseIndex + i, index);
+        }
+
+        bounds.add(drawable->bounds);
+        baseVertex += drawable->vertexCount;
+        baseIndex += drawable->indexCount;
+    }
+
+    auto vid = VertexIndexDraw::create();
+    vid->firstBinding = prototype.firstBinding;
+    vid->assignArrays(arrays);
+    vid->assignIndices(indices);
+    vid->indexCount = indexCount;
+    vid->instanceCount = 1;
+
+    numDrawablesMerged += static_cast<uint32_t>(batch.size());
+    ++numDrawablesCreated;
+
+    if (!addCullNodes || !bounds.valid()) return vid;
+
+    dvec3 center = (bounds.min + bounds.max) * 0.5;
+    return CullNode::create(dsphere(center, length(bounds.max - center)), vid);
+}
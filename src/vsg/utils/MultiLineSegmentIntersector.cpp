@@ -0,0 +1,470 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/io/Logger.h>
+#include <vsg/maths/transform.h>
+#include <vsg/nodes/CullGroup.h>
+#include <vsg/nodes/CullNode.h>
+#include <vsg/nodes/DepthSorted.h>
+#include <vsg/nodes/LOD.h>
+#include <vsg/nodes/PagedLOD.h>
+#include <vsg/nodes/Transform.h>
+#include <vsg/threading/Latch.h>
+#include <vsg/utils/MultiLineSegmentIntersector.h>
+
+using namespace vsg;
+
+namespace vsg
+{
+    /// intersect each triangle with a packet of line segments, using the same tests as LineSegmentIntersector so the results match per line segment.
+    struct PacketTriangleIntersector
+    {
+        struct Ray
+        {
+            uint32_t index;
+            dvec3 start;
+            dvec3 d;
+            double length;
+            double inverse_length;
+        };
+
+        MultiLineSegmentIntersector& intersector;
+        std::vector<Ray> rays;
+        ref_ptr<const vec3Array> vertices;
+        uint32_t instanceIndex = 0;
+        size_t numIntersections = 0;
+
+        bool useInstanceMatrix = false;
+        dmat4 instanceMatrix;
+
+        explicit PacketTriangleIntersector(MultiLineSegmentIntersector& in_intersector) :
+            intersector(in_intersector)
+        {
+        }
+
+        /// set up the vertices and rays for the specified instance, returning false if no vertices are available
+        bool instance(ArrayState& arrayState, uint32_t index, const std::vector<uint32_t>& active, const MultiLineSegmentIntersector::LineSegments& lineSegments)
+        {
+            instanceIndex = index;
+
+            // when the instance is an affine transform of the vertices, transform the line segments into the instance's frame rather than copying the vertices
+            useInstanceMatrix = arrayState.instanceMatrix(index, instanceMatrix);
+            vertices = useInstanceMatrix ? arrayState.vertices : arrayState.vertexArray(index);
+            if (!vertices) return false;
+
+            dmat4 inverseInstanceMatrix;
+            if (useInstanceMatrix) inverseInstanceMatrix = inverse(instanceMatrix);
+
+            rays.resize(active.size());
+            for (size_t i = 0; i < active.size(); ++i)
+            {
+                auto& ray = rays[i];
+                const auto& ls = lineSegments[active[i]];
+
+                dvec3 start = useInstanceMatrix ? inverseInstanceMatrix * ls.start : ls.start;
+                dvec3 end = useInstanceMatrix ? inverseInstanceMatrix * ls.end : ls.end;
+
+                ray.index = active[i];
+                ray.start = start;
+                ray.d = end - start;
+                ray.length = vsg::length(ray.d);
+                ray.inverse_length = (ray.length != 0.0) ? 1.0 / ray.length : 0.0;
+                ray.d *= ray.inverse_length;
+            }
+
+            return true;
+        }
+
+        /// intersect all rays with a single triangle
+        void intersect(uint32_t i0, uint32_t i1, uint32_t i2)
+        {
+            const vec3& v0 = vertices->at(i0);
+            const vec3& v1 = vertices->at(i1);
+            const vec3& v2 = vertices->at(i2);
+
+            dvec3 dv0(v0);
+            dvec3 E2 = dvec3(v2) - dv0;
+            dvec3 E1 = dvec3(v1) - dv0;
+
+            const double epsilon = 1e-10;
+            for (auto& ray : rays)
+            {
+                dvec3 T = ray.start - dv0;
+                dvec3 P = cross(ray.d, E2);
+
+                double det = dot(P, E1);
+
+                double u, v;
+                if (det > epsilon)
+                {
+                    u = dot(P, T);
+                    if (u < 0.0 || u > det) continue;
+
+                    dvec3 Q = cross(T, E1);
+                    v = dot(Q, ray.d);
+                    if (v < 0.0 || v > det) continue;
+
+                    if ((u + v) > det) continue;
+
+                    double inv_det = 1.0 / det;
+                    double t = dot(Q, E2) * inv_det;
+                    if (t < 0.0 || t > ray.length) continue;
+
+                    add(ray, u * inv_det, v * inv_det, t, i0, i1, i2);
+                }
+                else if (det < -epsilon)
+                {
+                    u = dot(P, T);
+                    if (u > 0.0 || u < det) continue;
+
+                    dvec3 Q = cross(T, E1);
+                    v = dot(Q, ray.d);
+                    if (v > 0.0 || v < det) continue;
+
+                    if ((u + v) < det) continue;
+
+                    double inv_det = 1.0 / det;
+                    double t = dot(Q, E2) * inv_det;
+                    if (t < 0.0 || t > ray.length) continue;
+
+                    add(ray, u * inv_det, v * inv_det, t, i0, i1, i2);
+                }
+            }
+        }
+
+        void add(const Ray& ray, double u, double v, double t, uint32_t i0, uint32_t i1, uint32_t i2)
+        {
+            double r0 = 1.0 - u - v;
+            double r1 = u;
+            double r2 = v;
+            double r = t * ray.inverse_length;
+
+            dvec3 intersection = dvec3(vertices->at(i0)) * r0 + dvec3(vertices->at(i1)) * r1 + dvec3(vertices->at(i2)) * r2;
+            if (useInstanceMatrix) intersection = instanceMatrix * intersection;
+
+            intersector.add(ray.index, intersection, r, {{i0, r0}, {i1, r1}, {i2, r2}}, instanceIndex);
+            ++numIntersections;
+        }
+    };
+
+    static bool intersects(const MultiLineSegmentIntersector::LineSegment& lineSegment, const dsphere& bs)
+    {
+        const dvec3& start = lineSegment.start;
+        const dvec3& end = lineSegment.end;
+
+        dvec3 sm = start - bs.center;
+        double c = length2(sm) - bs.radius * bs.radius;
+        if (c < 0.0) return true;
+
+        dvec3 se = end - start;
+        double a = length2(se);
+        double b = dot(sm, se) * 2.0;
+        double d = b * b - 4.0 * a * c;
+
+        if (d < 0.0) return false;
+
+        d = sqrt(d);
+
+        double div = 1.0 / (2.0 * a);
+
+        double r1 = (-b - d) * div;
+        double r2 = (-b + d) * div;
+
+        if (r1 <= 0.0 && r2 <= 0.0) return false;
+        if (r1 >= 1.0 && r2 >= 1.0) return false;
+
+        return true;
+    }
+
+} // namespace vsg
+
+MultiLineSegmentIntersector::MultiLineSegmentIntersector(const LineSegments& in_lineSegments, ref_ptr<ArrayState> initialArrayData) :
+    Inherit(initialArrayData),
+    lineSegments(in_lineSegments),
+    intersections(in_lineSegments.size())
+{
+    _lineSegmentsStack.push_back(lineSegments);
+
+    Indices active(lineSegments.size());
+    for (size_t i = 0; i < active.size(); ++i) active[i] = static_cast<uint32_t>(i);
+    _activeStack.push_back(std::move(active));
+}
+
+ref_ptr<MultiLineSegmentIntersector::Intersection> MultiLineSegmentIntersector::add(uint32_t lineSegmentIndex, const dvec3& coord, double ratio, const IndexRatios& indexRatios, uint32_t instanceIndex)
+{
+    auto localToWorld = computeTransform(_nodePath);
+    auto intersection = Intersection::create(coord, localToWorld * coord, ratio, localToWorld, _nodePath, arrayStateStack.back()->arrays, indexRatios, instanceIndex);
+    intersections[lineSegmentIndex].emplace_back(intersection);
+
+    return intersection;
+}
+
+void MultiLineSegmentIntersector::intersect(const Node& node, ref_ptr<OperationThreads> operationThreads, size_t minimumBatchSize)
+{
+    size_t numBatches = 1;
+    if (operationThreads && minimumBatchSize > 0)
+    {
+        numBatches = std::min(operationThreads->threads.size() + 1, lineSegments.size() / minimumBatchSize);
+    }
+
+    if (numBatches <= 1)
+    {
+        node.accept(*this);
+        return;
+    }
+
+    struct IntersectOperation : public Operation
+    {
+        IntersectOperation(ref_ptr<MultiLineSegmentIntersector> in_intersector, const Node& in_node, ref_ptr<Latch> in_latch) :
+            intersector(in_intersector),
+            node(in_node),
+            latch(in_latch) {}
+
+        void run() override
+        {
+            node.accept(*intersector);
+            latch->count_down();
+        }
+
+        ref_ptr<MultiLineSegmentIntersector> intersector;
+        const Node& node;
+        ref_ptr<Latch> latch;
+    };
+
+    // use latch to synchronize this thread with the intersection threads
+    auto latch = Latch::create(static_cast<int>(numBatches));
+
+    std::vector<ref_ptr<MultiLineSegmentIntersector>> batches;
+    size_t batchSize = (lineSegments.size() + numBatches - 1) / numBatches;
+    for (size_t begin = 0; begin < lineSegments.size(); begin += batchSize)
+    {
+        auto end = std::min(begin + batchSize, lineSegments.size());
+        auto batch = MultiLineSegmentIntersector::create(LineSegments(lineSegments.begin() + begin, lineSegments.begin() + end), arrayStateStack.front()->cloneArrayState());
+        batches.push_back(batch);
+
+        operationThreads->add(ref_ptr<Operation>(new IntersectOperation(batch, node, latch)));
+    }
+
+    // account for any rounding in the batch sizes leaving fewer batches than planned
+    for (size_t i = batches.size(); i < numBatches; ++i) latch->count_down();
+
+    // use this thread to intersect as well
+    operationThreads->run();
+
+    // wait till all the batches have completed
+    latch->wait();
+
+    // merge the batch results
+    size_t offset = 0;
+    for (auto& batch : batches)
+    {
+        for (auto& batchIntersections : batch->intersections)
+        {
+            auto& lineSegmentIntersections = intersections[offset++];
+            lineSegmentIntersections.insert(lineSegmentIntersections.end(), batchIntersections.begin(), batchIntersections.end());
+        }
+    }
+}
+
+bool MultiLineSegmentIntersector::pushActive(const dsphere& bs)
+{
+    if (!bs.valid()) return false;
+
+    const auto& localLineSegments = _lineSegmentsStack.back();
+    const auto& active = _activeStack.back();
+
+    Indices subset;
+    for (auto index : active)
+    {
+        if (vsg::intersects(localLineSegments[index], bs)) subset.push_back(index);
+    }
+
+    if (subset.empty()) return false;
+
+    _activeStack.push_back(std::move(subset));
+    return true;
+}
+
+void MultiLineSegmentIntersector::popActive()
+{
+    _activeStack.pop_back();
+}
+
+void MultiLineSegmentIntersector::apply(const LOD& lod)
+{
+    if (!pushActive(lod.bound)) return;
+
+    _nodePath.push_back(&lod);
+
+    for (auto& child : lod.children)
+    {
+        if (child.node)
+        {
+            child.node->accept(*this);
+            break;
+        }
+    }
+
+    _nodePath.pop_back();
+
+    popActive();
+}
+
+void MultiLineSegmentIntersector::apply(const PagedLOD& plod)
+{
+    if (!pushActive(plod.bound)) return;
+
+    _nodePath.push_back(&plod);
+
+    for (auto& child : plod.children)
+    {
+        if (child.node)
+        {
+            child.node->accept(*this);
+            break;
+        }
+    }
+
+    _nodePath.pop_back();
+
+    popActive();
+}
+
+void MultiLineSegmentIntersector::apply(const CullNode& cn)
+{
+    if (!pushActive(cn.bound)) return;
+
+    _nodePath.push_back(&cn);
+    cn.traverse(*this);
+    _nodePath.pop_back();
+
+    popActive();
+}
+
+void MultiLineSegmentIntersector::apply(const CullGroup& cg)
+{
+    if (!pushActive(cg.bound)) return;
+
+    _nodePath.push_back(&cg);
+    cg.traverse(*this);
+    _nodePath.pop_back();
+
+    popActive();
+}
+
+void MultiLineSegmentIntersector::apply(const DepthSorted& ds)
+{
+    if (!pushActive(ds.bound)) return;
+
+    _nodePath.push_back(&ds);
+    ds.traverse(*this);
+    _nodePath.pop_back();
+
+    popActive();
+}
+
+void MultiLineSegmentIntersector::pushTransform(const Transform& transform)
+{
+    auto& l2wStack = localToWorldStack();
+    auto& w2lStack = worldToLocalStack();
+
+    dmat4 localToWorld = l2wStack.empty() ? transform.transform(dmat4{}) : transform.transform(l2wStack.back());
+    dmat4 worldToLocal = inverse(localToWorld);
+
+    l2wStack.push_back(localToWorld);
+    w2lStack.push_back(worldToLocal);
+
+    // only the active line segments need transforming into the local coordinate frame
+    LineSegments localLineSegments(lineSegments.size());
+    for (auto index : _activeStack.back())
+    {
+        const auto& worldLineSegment = lineSegments[index];
+        localLineSegments[index] = LineSegment{worldToLocal * worldLineSegment.start, worldToLocal * worldLineSegment.end};
+    }
+
+    _lineSegmentsStack.push_back(std::move(localLineSegments));
+}
+
+void MultiLineSegmentIntersector::popTransform()
+{
+    _lineSegmentsStack.pop_back();
+    localToWorldStack().pop_back();
+    worldToLocalStack().pop_back();
+}
+
+bool MultiLineSegmentIntersector::intersects(const dsphere& bs)
+{
+    if (!bs.valid()) return false;
+
+    const auto& localLineSegments = _lineSegmentsStack.back();
+    for (auto index : _activeStack.back())
+    {
+        if (vsg::intersects(localLineSegments[index], bs)) return true;
+    }
+    return false;
+}
+
+bool MultiLineSegmentIntersector::intersectDraw(uint32_t firstVertex, uint32_t vertexCount, uint32_t firstInstance, uint32_t instanceCount)
+{
+    auto& arrayState = *arrayStateStack.back();
+    if (arrayState.topology != VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST || vertexCount < 3) return false;
+
+    PacketTriangleIntersector triIntersector(*this);
+
+    uint32_t lastIndex = instanceCount > 1 ? (firstInstance + instanceCount) : firstInstance + 1;
+    for (uint32_t instanceIndex = firstInstance; instanceIndex < lastIndex; ++instanceIndex)
+    {
+        if (!triIntersector.instance(arrayState, instanceIndex, _activeStack.back(), _lineSegmentsStack.back())) break;
+
+        uint32_t endVertex = int((firstVertex + vertexCount) / 3.0f) * 3;
+
+        for (uint32_t i = firstVertex; i < endVertex; i += 3)
+        {
+            triIntersector.intersect(i, i + 1, i + 2);
+        }
+    }
+
+    return triIntersector.numIntersections > 0;
+}
+
+bool MultiLineSegmentIntersector::intersectDrawIndexed(uint32_t firstIndex, uint32_t indexCount, uint32_t firstInstance, uint32_t instanceCount)
+{
+    auto& arrayState = *arrayStateStack.back();
+    if (arrayState.topology != VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST || indexCount < 3) return false;
+
+    PacketTriangleIntersector triIntersector(*this);
+
+    uint32_t lastIndex = instanceCount > 1 ? (firstInstance + instanceCount) : firstInstance + 1;
+    for (uint32_t instanceIndex = firstInstance; instanceIndex < lastIndex; ++instanceIndex)
+    {
+        if (!triIntersector.instance(arrayState, instanceIndex, _activeStack.back(), _lineSegmentsStack.back())) continue;
+
+        uint32_t endIndex = int((firstIndex + indexCount) / 3.0f) * 3;
+
+        if (ushort_indices)
+        {
+            for (uint32_t i = firstIndex; i < endIndex; i += 3)
+            {
+                triIntersector.intersect(ushort_indices->at(i), ushort_indices->at(i + 1), ushort_indices->at(i + 2));
+            }
+        }
+        else if (uint_indices)
+        {
+            for (uint32_t i = firstIndex; i < endIndex; i += 3)
+            {
+                triIntersector.intersect(uint_indices->at(i), uint_indices->at(i + 1), uint_indices->at(i + 2));
+            }
+        }
+    }
+
+    return triIntersector.numIntersections > 0;
+}
@@ -0,0 +1,374 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/commands/DrawIndexed.h>
+#include <vsg/nodes/Geometry.h>
+#include <vsg/nodes/StateGroup.h>
+#include <vsg/nodes/VertexIndexDraw.h>
+#include <vsg/state/GraphicsPipeline.h>
+#include <vsg/state/InputAssemblyState.h>
+#include <vsg/utils/OptimizeVertexCache.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <limits>
+
+using namespace vsg;
+
+namespace
+{
+    // uniform access to ubyte, ushort and uint index arrays
+    struct IndexAccessor
+    {
+        explicit IndexAccessor(const Data& indices) :
+            ubyte_indices(const_cast<ubyteArray*>(indices.cast<ubyteArray>())),
+            ushort_indices(const_cast<ushortArray*>(indices.cast<ushortArray>())),
+            uint_indices(const_cast<uintArray*>(indices.cast<uintArray>())) {}
+
+        ubyteArray* ubyte_indices;
+        ushortArray* ushort_indices;
+        uintArray* uint_indices;
+
+        bool valid() const { return ubyte_indices || ushort_indices || uint_indices; }
+
+        uint32_t get(uint32_t i) const
+        {
+            if (ushort_indices) return ushort_indices->at(i);
+            if (uint_indices) return uint_indices->at(i);
+            return ubyte_indices->at(i);
+        }
+
+        void set(uint32_t i, uint32_t value)
+        {
+            if (ushort_indices)
+                ushort_indices->set(i, static_cast<uint16_t>(value));
+            else if (uint_indices)
+                uint_indices->set(i, value);
+            else
+                ubyte_indices->set(i, static_cast<uint8_t>(value));
+        }
+    };
+
+    // Forsyth's linear speed vertex cache optimisation, reordering the triangles in place.
+    void optimizeTriangleOrder(IndexAccessor& indices, uint32_t firstIndex, uint32_t indexCount, uint32_t cacheSize)
+    {
+        uint32_t numTriangles = indexCount / 3;
+        if (numTriangles < 2) return;
+
+        std::vector<uint32_t> triangles(numTriangles * 3);
+        uint32_t numVertices = 0;
+        for (uint32_t i = 0; i < triangles.size(); ++i)
+        {
+            triangles[i] = indices.get(firstIndex + i);
+            numVertices = std::max(numVertices, triangles[i] + 1);
+        }
+
+        // per vertex triangle adjacency
+        std::vector<uint32_t> adjacencyOffsets(numVertices + 1, 0);
+        for (auto v : triangles) ++adjacencyOffsets[v + 1];
+        for (uint32_t v = 0; v < numVertices; ++v) adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+
+        std::vector<uint32_t> remaining(numVertices);
+        for (uint32_t v = 0; v < numVertices; ++v) remaining[v] = adjacencyOffsets[v + 1] - adjacencyOffsets[v];
+
+        std::vector<uint32_t> adjacency(triangles.size());
+        {
+            std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+            for (uint32_t t = 0; t < numTriangles; ++t)
+            {
+                for (uint32_t c = 0; c < 3; ++c) adjacency[fill[triangles[t * 3 + c]]++] = t;
+            }
+        }
+
+        auto vertexScore = [cacheSize](int cachePosition, uint32_t numRemaining) -> float {
+            if (numRemaining == 0) return -1.0f;
+
+            float score = 0.0f;
+            if (cachePosition >= 0)
+            {
+                // the vertices of the last triangle get a fixed score so there is no preference between them
+                if (cachePosition < 3)
+                    score = 0.75f;
+                else
+                    score = std::pow(1.0f - static_cast<float>(cachePosition - 3) / static_cast<float>(cacheSize - 3), 1.5f);
+            }
+            return score + 2.0f / std::sqrt(static_cast<float>(numRemaining));
+        };
+
+        std::vector<int> cachePositions(numVertices, -1);
+        std::vector<float> vertexScores(numVertices);
+        for (uint32_t v = 0; v < numVertices; ++v) vertexScores[v] = vertexScore(-1, remaining[v]);
+
+        std::vector<float> triangleScores(numTriangles);
+        std::vector<bool> emitted(numTriangles, false);
+        for (uint32_t t = 0; t < numTriangles; ++t)
+        {
+            triangleScores[t] = vertexScores[triangles[t * 3]] + vertexScores[triangles[t * 3 + 1]] + vertexScores[triangles[t * 3 + 2]];
+        }
+
+        std::vector<uint32_t> cache, newCache;
+        cache.reserve(cacheSize + 3);
+        newCache.reserve(cacheSize + 3);
+
+        uint32_t bestTriangle = static_cast<uint32_t>(std::max_element(triangleScores.begin(), triangleScores.end()) - triangleScores.begin());
+        uint32_t nextUnemitted = 0;
+        uint32_t outputIndex = firstIndex;
+
+        for (uint32_t n = 0; n < numTriangles; ++n)
+        {
+            if (bestTriangle == numTriangles)
+            {
+                // no candidates adjacent to the cache so fall back to the next triangle in the original order
+                while (emitted[nextUnemitted]) ++nextUnemitted;
+                bestTriangle = nextUnemitted;
+            }
+
+            emitted[bestTriangle] = true;
+            const uint32_t* tri = &triangles[bestTriangle * 3];
+            for (uint32_t c = 0; c < 3; ++c)
+            {
+                uint32_t v = tri[c];
+                indices.set(outputIndex++, v);
+
+                // remove the triangle from the vertex's adjacency list
+                auto begin = adjacency.begin() + adjacencyOffsets[v];
+                auto end = begin + remaining[v];
+                std::iter_swap(std::find(begin, end, bestTriangle), end - 1);
+                --remaining[v];
+            }
+
+            // move the triangle's vertices to the front of the cache
+            newCache.assign(tri, tri + 3);
+            for (auto v : cache)
+            {
+                if (v != tri[0] && v != tri[1] && v != tri[2]) newCache.push_back(v);
+            }
+            cache.swap(newCache);
+
+            for (size_t i = 0; i < cache.size(); ++i)
+            {
+                uint32_t v = cache[i];
+                cachePositions[v] = i < cacheSize ? static_cast<int>(i) : -1;
+                vertexScores[v] = vertexScore(cachePositions[v], remaining[v]);
+            }
+
+            // rescore the triangles that use the cached vertices and select the best one
+            float bestScore = -1.0f;
+            bestTriangle = numTriangles;
+            for (auto v : cache)
+            {
+                auto begin = adjacencyOffsets[v];
+                for (uint32_t a = begin; a < begin + remaining[v]; ++a)
+                {
+                    uint32_t t = adjacency[a];
+                    float score = vertexScores[triangles[t * 3]] + vertexScores[triangles[t * 3 + 1]] + vertexScores[triangles[t * 3 + 2]];
+                    triangleScores[t] = score;
+                    if (score > bestScore)
+                    {
+                        bestScore = score;
+                        bestTriangle = t;
+                    }
+                }
+            }
+
+            if (cache.size() > cacheSize) cache.resize(cacheSize);
+        }
+    }
+} // namespace
+
+OptimizeVertexCache::OptimizeVertexCache()
+{
+}
+
+OptimizeVertexCache::CacheStatistics OptimizeVertexCache::analyze(const Data& indices, uint32_t firstIndex, uint32_t indexCount, uint32_t cacheSize)
+{
+    CacheStatistics statistics;
+
+    IndexAccessor accessor(indices);
+    if (!accessor.valid() || cacheSize == 0) return statistics;
+
+    indexCount = std::min(indexCount, static_cast<uint32_t>(indices.valueCount()) - std::min(firstIndex, static_cast<uint32_t>(indices.valueCount())));
+    indexCount -= indexCount % 3;
+
+    std::deque<uint32_t> cache;
+    std::set<uint32_t> vertices;
+    for (uint32_t i = firstIndex; i < firstIndex + indexCount; ++i)
+    {
+        uint32_t v = accessor.get(i);
+        vertices.insert(v);
+        if (std::find(cache.begin(), cache.end(), v) == cache.end())
+        {
+            ++statistics.numCacheMisses;
+            cache.push_back(v);
+            if (cache.size() > cacheSize) cache.pop_front();
+        }
+    }
+
+    statistics.numTriangles = indexCount / 3;
+    statistics.numVertices = vertices.size();
+    return statistics;
+}
+
+void OptimizeVertexCache::apply(Object& object)
+{
+    object.traverse(*this);
+}
+
+void OptimizeVertexCache::apply(StateGroup& stateGroup)
+{
+    size_t previousSize = _topologyStack.size();
+    for (auto& stateCommand : stateGroup.stateCommands)
+    {
+        auto bindPipeline = stateCommand->cast<BindGraphicsPipeline>();
+        if (!bindPipeline || !bindPipeline->pipeline) continue;
+
+        VkPrimitiveTopology topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        for (auto& pipelineState : bindPipeline->pipeline->pipelineStates)
+        {
+            if (auto inputAssemblyState = pipelineState->cast<InputAssemblyState>()) topology = inputAssemblyState->topology;
+        }
+        _topologyStack.push_back(topology);
+    }
+
+    stateGroup.traverse(*this);
+
+    _topologyStack.resize(previousSize);
+}
+
+void OptimizeVertexCache::apply(VertexIndexDraw& vid)
+{
+    if (!vid.indices || !vid.indices->data) return;
+
+    _optimize(vid.arrays, *vid.indices->data, {Range{vid.firstIndex, vid.indexCount, vid.vertexOffset}}, true);
+}
+
+void OptimizeVertexCache::apply(Geometry& geometry)
+{
+    if (!geometry.indices || !geometry.indices->data) return;
+
+    std::vector<Range> ranges;
+    bool nonIndexedDraws = false;
+    for (auto& command : geometry.commands)
+    {
+        if (auto drawIndexed = command->cast<DrawIndexed>())
+            ranges.push_back(Range{drawIndexed->firstIndex, drawIndexed->indexCount, drawIndexed->vertexOffset});
+        else
+            nonIndexedDraws = true;
+    }
+
+    // non indexed draws rely on the order of the vertices
+    _optimize(geometry.arrays, *geometry.indices->data, ranges, !nonIndexedDraws);
+}
+
+void OptimizeVertexCache::_optimize(BufferInfoList& arrays, Data& indices, const std::vector<Range>& ranges, bool vertexOrderIndependent)
+{
+    VkPrimitiveTopology topology = _topologyStack.empty() ? defaultTopology : _topologyStack.back();
+    if (topology != VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST || indices.dynamic()) return;
+
+    IndexAccessor accessor(indices);
+    if (!accessor.valid()) return;
+
+    // shared index arrays only need optimizing once
+    if (_optimized.count(&indices) != 0) return;
+    _optimized.insert(&indices);
+
+    uint32_t numIndices = static_cast<uint32_t>(indices.valueCount());
+    for (auto& range : ranges)
+    {
+        if (range.indexCount == 0) continue;
+        if (range.firstIndex + range.indexCount > numIndices) return;
+        before += analyze(indices, range.firstIndex, range.indexCount, statisticsCacheSize);
+    }
+
+    for (auto& range : ranges)
+    {
+        if (range.indexCount >= 6) optimizeTriangleOrder(accessor, range.firstIndex, range.indexCount - range.indexCount % 3, std::max(cacheSize, 4u));
+        after += analyze(indices, range.firstIndex, range.indexCount, statisticsCacheSize);
+    }
+
+    indices.dirty();
+    ++numDrawablesOptimized;
+
+    if (!reorderVertices || !vertexOrderIndependent || arrays.empty() || !arrays[0] || !arrays[0]->data) return;
+
+    // vertices can only be reordered when no other object might rely on their order
+    if (indices.referenceCount() > 1) return;
+
+    uint32_t numVertices = static_cast<uint32_t>(arrays[0]->data->valueCount());
+    for (auto& bufferInfo : arrays)
+    {
+        if (!bufferInfo || !bufferInfo->data) return;
+        auto& data = *bufferInfo->data;
+        if (bufferInfo->referenceCount() > 1 || data.referenceCount() > 1 || data.dynamic()) return;
+        if (data.valueCount() != numVertices && data.valueCount() != 1) return;
+    }
+    for (auto& range : ranges)
+    {
+        if (range.vertexOffset != 0) return;
+    }
+    for (uint32_t i = 0; i < numIndices; ++i)
+    {
+        if (accessor.get(i) >= numVertices) return;
+    }
+
+    // assign new vertex positions in the order of first use
+    constexpr uint32_t unassigned = std::numeric_limits<uint32_t>::max();
+    std::vector<uint32_t> newIndices(numVertices, unassigned);
+    std::vector<uint32_t> oldIndices;
+    oldIndices.reserve(numVertices);
+    for (auto& range : ranges)
+    {
+        for (uint32_t i = range.firstIndex; i < range.firstIndex + range.indexCount; ++i)
+        {
+            uint32_t v = accessor.get(i);
+            if (newIndices[v] == unassigned)
+            {
+                newIndices[v] = static_cast<uint32_t>(oldIndices.size());
+                oldIndices.push_back(v);
+            }
+        }
+    }
+    for (uint32_t v = 0; v < numVertices; ++v)
+    {
+        if (newIndices[v] == unassigned)
+        {
+            newIndices[v] = static_cast<uint32_t>(oldIndices.size());
+            oldIndices.push_back(v);
+        }
+    }
+
+    for (uint32_t i = 0; i < numIndices; ++i)
+    {
+        accessor.set(i, newIndices[accessor.get(i)]);
+    }
+
+    std::vector<uint8_t> values;
+    for (auto& bufferInfo : arrays)
+    {
+        auto& data = *bufferInfo->data;
+        if (data.valueCount() != numVertices) continue;
+
+        size_t valueSize = data.valueSize();
+        values.resize(valueSize * numVertices);
+        for (uint32_t i = 0; i < numVertices; ++i)
+        {
+            std::memcpy(values.data() + i * valueSize, data.dataPointer(oldIndices[i]), valueSize);
+        }
+        for (uint32_t i = 0; i < numVertices; ++i)
+        {
+            std::memcpy(data.dataPointer(i), values.data() + i * valueSize, valueSize);
+        }
+        data.dirty();
+    }
+}
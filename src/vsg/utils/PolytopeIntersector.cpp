@@ -37,10 +37,15 @@ namespace vsg
     {
         PolytopeIntersector& intersector;
         ArrayState& arrayState;
-        const Polytope& polytope;
+        const Polytope& sourcePolytope;
         ref_ptr<const vec3Array> sourceVertices;
         uint32_t instanceIndex = 0;
 
+        // polytope in the coordinate frame of sourceVertices
+        Polytope polytope;
+        bool useInstanceMatrix = false;
+        dmat4 instanceMatrix;
+
         std::vector<dvec3> processedVertices;
         std::vector<double> processedDistances;
         std::vector<dvec3> trimmedVertices;
@@ -49,6 +54,7 @@ namespace vsg
         PolytopePrimitiveIntersection(PolytopeIntersector& in_polyopeIntersector, ArrayState& in_arrayState, const Polytope& in_polytope) :
             intersector(in_polyopeIntersector),
             arrayState(in_arrayState),
+            sourcePolytope(in_polytope),
             polytope(in_polytope)
         {
             size_t maxNumOfProcessedVertices = 3 + polytope.size();
@@ -60,11 +66,36 @@ namespace vsg
 
         bool instance(uint32_t index)
         {
-            sourceVertices = arrayState.vertexArray(index);
             instanceIndex = index;
+
+            // when the instance is an affine transform of the vertices, transform the polytope into the instance's frame rather than copying the vertices
+            bool previousUseInstanceMatrix = useInstanceMatrix;
+            useInstanceMatrix = arrayState.instanceMatrix(index, instanceMatrix);
+            if (useInstanceMatrix)
+            {
+                sourceVertices = arrayState.vertices;
+                for (size_t i = 0; i < sourcePolytope.size(); ++i)
+                {
+                    polytope[i] = sourcePolytope[i] * instanceMatrix;
+                }
+            }
+            else
+            {
+                sourceVertices = arrayState.vertexArray(index);
+                if (previousUseInstanceMatrix) polytope = sourcePolytope;
+            }
+
             return sourceVertices.valid();
         }
 
+        void add(const dvec3& intersection, const std::vector<uint32_t>& indices)
+        {
+            if (useInstanceMatrix)
+                intersector.add(instanceMatrix * intersection, indices, instanceIndex);
+            else
+                intersector.add(intersection, indices, instanceIndex);
+        }
+
         void triangle(uint32_t i0, uint32_t i1, uint32_t i2)
         {
             // create a convex polygon from the 3 input vertices
@@ -147,7 +178,7 @@ namespace vsg
             }
             intersection /= static_cast<double>(processedVertices.size());
 
-            intersector.add(intersection, {i0, i1, i2}, instanceIndex);
+            add(intersection, {i0, i1, i2});
         }
 
         void line(uint32_t i0, uint32_t i1)
@@ -175,7 +206,7 @@ namespace vsg
                 }
             }
             dvec3 intersection = (v0 + v1) * 0.5;
-            intersector.add(intersection, {i0, i1}, instanceIndex);
+            add(intersection, {i0, i1});
         }
 
         void point(uint32_t i0)
@@ -183,7 +214,7 @@ namespace vsg
             const dvec3 v0(sourceVertices->at(i0));
             if (vsg::inside(polytope, v0))
             {
-                intersector.add(v0, {i0}, instanceIndex);
+                add(v0, {i0});
             }
         }
     };
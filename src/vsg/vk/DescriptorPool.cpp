@@ -24,8 +24,7 @@ DescriptorPool::DescriptorPool(Device* device, uint32_t in_maxSets, const Descri
     maxSets(in_maxSets),
     descriptorPoolSizes(in_descriptorPoolSizes),
     _device(device),
-    _availableDescriptorSet(maxSets),
-    _availableDescriptorPoolSizes(descriptorPoolSizes)
+    _accounting(in_maxSets, in_descriptorPoolSizes)
 {
     VkDescriptorPoolCreateInfo poolInfo = {};
     poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
@@ -60,25 +59,33 @@ ref_ptr<DescriptorSet::Implementation> DescriptorPool::allocateDescriptorSet(Des
 {
     std::scoped_lock<std::mutex> lock(mutex);
 
-    if (_availableDescriptorSet == 0)
+    if (_accounting.availableSets() == 0)
     {
         return {};
     }
 
-    for (auto itr = _recyclingList.begin(); itr != _recyclingList.end(); ++itr)
+    if (_accounting.recycledSets() > 0)
     {
-        auto dsi = *itr;
-        if (dsi->_descriptorSetLayout.get() == descriptorSetLayout || compare_value_container(dsi->_descriptorSetLayout->bindings, descriptorSetLayout->bindings) == 0)
+        if (auto list_itr = _recyclingLists.find(descriptorSetLayout->bindingsSignature()); list_itr != _recyclingLists.end())
         {
-            // swap ownership so that DescriptorSet::Implementation now "has a" reference to this DescriptorPool
-            dsi->_descriptorPool = this;
-            _recyclingList.erase(itr);
-            --_availableDescriptorSet;
-            return dsi;
+            auto& recyclingList = list_itr->second;
+            for (auto itr = recyclingList.begin(); itr != recyclingList.end(); ++itr)
+            {
+                auto dsi = *itr;
+                if (dsi->_descriptorSetLayout.get() == descriptorSetLayout || compare_value_container(dsi->_descriptorSetLayout->bindings, descriptorSetLayout->bindings) == 0)
+                {
+                    // swap ownership so that DescriptorSet::Implementation now "has a" reference to this DescriptorPool
+                    dsi->_descriptorPool = this;
+                    recyclingList.erase(itr);
+                    if (recyclingList.empty()) _recyclingLists.erase(list_itr);
+                    _accounting.reuse();
+                    return dsi;
+                }
+            }
         }
     }
 
-    if (_availableDescriptorSet == _recyclingList.size())
+    if (!_accounting.newSetsAvailable())
     {
         vsg::debug("The only available vkDescriptorSets associated with DescriptorPool are in the recyclingList, but none are compatible.");
         return {};
@@ -87,28 +94,11 @@ ref_ptr<DescriptorSet::Implementation> DescriptorPool::allocateDescriptorSet(Des
     DescriptorPoolSizes requiredDescriptorPoolSizes;
     descriptorSetLayout->getDescriptorPoolSizes(requiredDescriptorPoolSizes);
 
-    auto newDescriptorPoolSizes = _availableDescriptorPoolSizes;
-    for (auto& [type, descriptorCount] : requiredDescriptorPoolSizes)
+    if (!_accounting.allocate(requiredDescriptorPoolSizes))
     {
-        uint32_t foundDescriptorCount = 0;
-        for (auto& [availableType, availableCount] : newDescriptorPoolSizes)
-        {
-            if (availableType == type)
-            {
-                uint32_t descriptorsToConsume = descriptorCount - foundDescriptorCount;
-                if (descriptorsToConsume > availableCount)
-                    descriptorsToConsume = availableCount;
-                foundDescriptorCount += descriptorsToConsume;
-                availableCount -= descriptorsToConsume;
-            }
-        }
-        if (foundDescriptorCount < descriptorCount)
-            return {};
+        return {};
     }
 
-    _availableDescriptorPoolSizes.swap(newDescriptorPoolSizes);
-    --_availableDescriptorSet;
-
     auto dsi = DescriptorSet::Implementation::create(this, descriptorSetLayout);
     vsg::debug("DescriptorPool::allocateDescriptorSet(..) allocated new ", dsi);
     return dsi;
@@ -120,8 +110,9 @@ void DescriptorPool::freeDescriptorSet(ref_ptr<DescriptorSet::Implementation> ds
         // swap ownership so that DescriptorSet::Implementation' reference is reset to null and while this DescriptorPool takes a reference to it.
         // acquire lock within local scope so that subsequent dsi->_descriptorPool = {} call doesn't unref and (possibly) delete this DescriptorPool while lock still held.
         std::scoped_lock<std::mutex> lock(mutex);
-        _recyclingList.push_back(dsi);
-        ++_availableDescriptorSet;
+        uint64_t signature = dsi->_descriptorSetLayout ? dsi->_descriptorSetLayout->bindingsSignature() : 0;
+        _recyclingLists[signature].push_back(dsi);
+        _accounting.recycle();
     }
     dsi->_descriptorPool = {};
 }
@@ -130,9 +121,9 @@ bool DescriptorPool::available(uint32_t& numSets, DescriptorPoolSizes& available
 {
     std::scoped_lock<std::mutex> lock(mutex);
 
-    if (_availableDescriptorSet == 0) return false;
+    if (_accounting.availableSets() == 0) return false;
 
-    numSets += _availableDescriptorSet;
+    numSets += _accounting.availableSets();
 
     for (auto& dps : descriptorPoolSizes)
     {
@@ -147,18 +138,21 @@ bool DescriptorPool::available(uint32_t& numSets, DescriptorPoolSizes& available
         }
     }
 
-    for (const auto& dsi : _recyclingList)
+    for (const auto& [signature, recyclingList] : _recyclingLists)
     {
-        if (dsi->_descriptorSetLayout)
+        for (const auto& dsi : recyclingList)
         {
-            for (auto& binding : dsi->_descriptorSetLayout->bindings)
+            if (dsi->_descriptorSetLayout)
             {
-                // increment any entries that are already in the descriptorPoolSizes vector
-                auto itr = std::find_if(availableDescriptorPoolSizes.begin(), availableDescriptorPoolSizes.end(), [&binding](const VkDescriptorPoolSize& value) { return value.type == binding.descriptorType; });
-                if (itr != availableDescriptorPoolSizes.end())
-                    itr->descriptorCount += binding.descriptorCount;
-                else
-                    availableDescriptorPoolSizes.push_back(VkDescriptorPoolSize{binding.descriptorType, binding.descriptorCount});
+                for (auto& binding : dsi->_descriptorSetLayout->bindings)
+                {
+                    // increment any entries that are already in the descriptorPoolSizes vector
+                    auto itr = std::find_if(availableDescriptorPoolSizes.begin(), availableDescriptorPoolSizes.end(), [&binding](const VkDescriptorPoolSize& value) { return value.type == binding.descriptorType; });
+                    if (itr != availableDescriptorPoolSizes.end())
+                        itr->descriptorCount += binding.descriptorCount;
+                    else
+                        availableDescriptorPoolSizes.push_back(VkDescriptorPoolSize{binding.descriptorType, binding.descriptorCount});
+                }
             }
         }
     }
@@ -168,24 +162,9 @@ bool DescriptorPool::available(uint32_t& numSets, DescriptorPoolSizes& available
 
 bool DescriptorPool::used(uint32_t& numSets, DescriptorPoolSizes& usedDescriptorPoolSizes) const
 {
-    if (maxSets == _availableDescriptorSet) return false;
-
-    numSets += maxSets - _availableDescriptorSet;
+    std::scoped_lock<std::mutex> lock(mutex);
 
-    for (auto& dps : descriptorPoolSizes)
-    {
-        auto itr = std::find_if(_availableDescriptorPoolSizes.begin(), _availableDescriptorPoolSizes.end(), [&dps](const VkDescriptorPoolSize& value) { return value.type == dps.type; });
-        if (itr != _availableDescriptorPoolSizes.end())
-        {
-            uint32_t usedDescriptorCount = dps.descriptorCount - itr->descriptorCount;
-            auto used_itr = std::find_if(usedDescriptorPoolSizes.begin(), usedDescriptorPoolSizes.end(), [&dps](const VkDescriptorPoolSize& value) { return value.type == dps.type; });
-            if (used_itr != usedDescriptorPoolSizes.end())
-                used_itr += usedDescriptorCount;
-            else
-                usedDescriptorPoolSizes.push_back(VkDescriptorPoolSize{dps.type, usedDescriptorCount});
-        }
-    }
-    return true;
+    return _accounting.used(numSets, usedDescriptorPoolSizes);
 }
 
 void DescriptorPool::report(std::ostream& out, indentation indent) const
@@ -203,31 +182,38 @@ void DescriptorPool::report(std::ostream& out, indentation indent) const
     indent -= 4;
     out << indent << "}" << std::endl;
 
-    out << indent << "_availableDescriptorSet = " << _availableDescriptorSet << std::endl;
-    out << indent << "_availableDescriptorPoolSizes = " << _availableDescriptorPoolSizes.size() << " {" << std::endl;
+    out << indent << "availableSets = " << _accounting.availableSets() << std::endl;
+    out << indent << "availableDescriptorPoolSizes = " << _accounting.availableDescriptorPoolSizes().size() << " {" << std::endl;
     indent += 4;
-    for (const auto& dps : _availableDescriptorPoolSizes)
+    for (const auto& dps : _accounting.availableDescriptorPoolSizes())
     {
         out << indent << "VkDescriptorPoolSize { " << dps.type << ", " << dps.descriptorCount << " }" << std::endl;
     }
     indent -= 4;
     out << indent << "}" << std::endl;
 
-    out << indent << "_recyclingList " << _recyclingList.size() << " {" << std::endl;
+    out << indent << "_recyclingLists " << _recyclingLists.size() << ", recycledSets = " << _accounting.recycledSets() << " {" << std::endl;
     indent += 4;
-    for (const auto& dsi : _recyclingList)
+    for (const auto& [signature, recyclingList] : _recyclingLists)
     {
-        out << indent << "DescriptorSet::Implementation " << dsi << ", descriptorSetLayout =  " << dsi->_descriptorSetLayout << " {" << std::endl;
+        out << indent << "signature " << signature << ", recyclingList " << recyclingList.size() << " {" << std::endl;
         indent += 4;
-        if (dsi->_descriptorSetLayout)
+        for (const auto& dsi : recyclingList)
         {
-            for (const auto& binding : dsi->_descriptorSetLayout->bindings)
+            out << indent << "DescriptorSet::Implementation " << dsi << ", descriptorSetLayout =  " << dsi->_descriptorSetLayout << " {" << std::endl;
+            indent += 4;
+            if (dsi->_descriptorSetLayout)
             {
-                out << indent << "VkDescriptorSetLayoutBinding { " << binding.binding << ", " << binding.descriptorType << ", " << binding.stageFlags << ", " << binding.pImmutableSamplers << " }" << std::endl;
+                for (const auto& binding : dsi->_descriptorSetLayout->bindings)
+                {
+                    out << indent << "VkDescriptorSetLayoutBinding { " << binding.binding << ", " << binding.descriptorType << ", " << binding.stageFlags << ", " << binding.pImmutableSamplers << " }" << std::endl;
+                }
             }
+            indent -= 4;
+            out << indent << " }" << std::endl;
         }
         indent -= 4;
-        out << indent << " }" << std::endl;
+        out << indent << "}" << std::endl;
     }
     indent -= 4;
     out << indent << "}" << std::endl;
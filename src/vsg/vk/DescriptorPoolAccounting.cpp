@@ -0,0 +1,87 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/vk/DescriptorPoolAccounting.h>
+
+#include <algorithm>
+
+using namespace vsg;
+
+DescriptorPoolAccounting::DescriptorPoolAccounting(uint32_t in_maxSets, const DescriptorPoolSizes& in_descriptorPoolSizes) :
+    maxSets(in_maxSets),
+    descriptorPoolSizes(in_descriptorPoolSizes),
+    _availableSets(in_maxSets),
+    _availableDescriptorPoolSizes(in_descriptorPoolSizes)
+{
+}
+
+bool DescriptorPoolAccounting::allocate(const DescriptorPoolSizes& requiredDescriptorPoolSizes)
+{
+    if (!newSetsAvailable()) return false;
+
+    auto newDescriptorPoolSizes = _availableDescriptorPoolSizes;
+    for (auto& [type, descriptorCount] : requiredDescriptorPoolSizes)
+    {
+        uint32_t foundDescriptorCount = 0;
+        for (auto& [availableType, availableCount] : newDescriptorPoolSizes)
+        {
+            if (availableType == type)
+            {
+                uint32_t descriptorsToConsume = descriptorCount - foundDescriptorCount;
+                if (descriptorsToConsume > availableCount)
+                    descriptorsToConsume = availableCount;
+                foundDescriptorCount += descriptorsToConsume;
+                availableCount -= descriptorsToConsume;
+            }
+        }
+        if (foundDescriptorCount < descriptorCount)
+            return false;
+    }
+
+    _availableDescriptorPoolSizes.swap(newDescriptorPoolSizes);
+    --_availableSets;
+    return true;
+}
+
+void DescriptorPoolAccounting::recycle()
+{
+    ++_numRecycled;
+    ++_availableSets;
+}
+
+void DescriptorPoolAccounting::reuse()
+{
+    --_numRecycled;
+    --_availableSets;
+}
+
+bool DescriptorPoolAccounting::used(uint32_t& numSets, DescriptorPoolSizes& usedDescriptorPoolSizes) const
+{
+    if (maxSets == _availableSets) return false;
+
+    numSets += maxSets - _availableSets;
+
+    for (auto& dps : descriptorPoolSizes)
+    {
+        auto itr = std::find_if(_availableDescriptorPoolSizes.begin(), _availableDescriptorPoolSizes.end(), [&dps](const VkDescriptorPoolSize& value) { return value.type == dps.type; });
+        if (itr != _availableDescriptorPoolSizes.end())
+        {
+            uint32_t usedDescriptorCount = dps.descriptorCount - itr->descriptorCount;
+            auto used_itr = std::find_if(usedDescriptorPoolSizes.begin(), usedDescriptorPoolSizes.end(), [&dps](const VkDescriptorPoolSize& value) { return value.type == dps.type; });
+            if (used_itr != usedDescriptorPoolSizes.end())
+                used_itr->descriptorCount += usedDescriptorCount;
+            else
+                usedDescriptorPoolSizes.push_back(VkDescriptorPoolSize{dps.type, usedDescriptorCount});
+        }
+    }
+    return true;
+}
@@ -72,6 +72,8 @@ void DescriptorPools::getDescriptorPoolSizesToUse(uint32_t& maxSets, DescriptorP
 
 void DescriptorPools::reserve(const ResourceRequirements& requirements)
 {
+    std::scoped_lock<std::mutex> lock(mutex);
+
     auto maxSets = requirements.computeNumDescriptorSets();
     auto descriptorPoolSizes = requirements.computeDescriptorPoolSizes();
 
@@ -87,10 +89,10 @@ void DescriptorPools::reserve(const ResourceRequirements& requirements)
             reserve_descriptorPoolSizes.push_back(dps);
     }
 
-    // compute the total available resources
+    // compute the total available resources, only the reserved pools count as the signature bucket pools are only used for their own DescriptorSetLayout
     uint32_t available_maxSets = 0;
     DescriptorPoolSizes available_descriptorPoolSizes;
-    for (auto& descriptorPool : descriptorPools)
+    for (auto& descriptorPool : _reservedPools)
     {
         descriptorPool->available(available_maxSets, available_descriptorPoolSizes);
     }
@@ -132,28 +134,53 @@ void DescriptorPools::reserve(const ResourceRequirements& requirements)
 
     // not enough descriptor resources available so allocator new DescriptorPool.
     getDescriptorPoolSizesToUse(required_maxSets, required_descriptorPoolSizes);
-    descriptorPools.push_back(vsg::DescriptorPool::create(device, required_maxSets, required_descriptorPoolSizes));
+    auto descriptorPool = vsg::DescriptorPool::create(device, required_maxSets, required_descriptorPoolSizes);
+    descriptorPools.push_back(descriptorPool);
+    _reservedPools.push_back(descriptorPool);
 }
 
 ref_ptr<DescriptorSet::Implementation> DescriptorPools::allocateDescriptorSet(DescriptorSetLayout* descriptorSetLayout)
 {
-    for (auto itr = descriptorPools.rbegin(); itr != descriptorPools.rend(); ++itr)
+    std::scoped_lock<std::mutex> lock(mutex);
+
+    // check the pools sized for this layout first, most recent first as they are the least likely to be full
+    auto& bucket = _signatureBuckets[descriptorSetLayout->bindingsSignature()];
+    for (auto itr = bucket.descriptorPools.rbegin(); itr != bucket.descriptorPools.rend(); ++itr)
+    {
+        if (auto dsi = (*itr)->allocateDescriptorSet(descriptorSetLayout)) return dsi;
+    }
+
+    for (auto itr = _reservedPools.rbegin(); itr != _reservedPools.rend(); ++itr)
     {
-        auto dsi = (*itr)->allocateDescriptorSet(descriptorSetLayout);
-        if (dsi) return dsi;
+        if (auto dsi = (*itr)->allocateDescriptorSet(descriptorSetLayout)) return dsi;
     }
 
     DescriptorPoolSizes descriptorPoolSizes;
     descriptorSetLayout->getDescriptorPoolSizes(descriptorPoolSizes);
 
-    uint32_t maxSets = 1;
-    getDescriptorPoolSizesToUse(maxSets, descriptorPoolSizes);
+    ref_ptr<DescriptorPool> descriptorPool;
+    if (reserve_count > 0)
+    {
+        // there are outstanding reserve(..) requirements so allocate a pool that also accommodates them
+        uint32_t maxSets = 1;
+        getDescriptorPoolSizesToUse(maxSets, descriptorPoolSizes);
 
-    auto descriptorPool = vsg::DescriptorPool::create(device, maxSets, descriptorPoolSizes);
-    auto dsi = descriptorPool->allocateDescriptorSet(descriptorSetLayout);
+        descriptorPool = vsg::DescriptorPool::create(device, maxSets, descriptorPoolSizes);
+        _reservedPools.push_back(descriptorPool);
+    }
+    else
+    {
+        // allocate a pool for just this layout, growing the number of sets for each successive pool
+        uint32_t maxSets = bucket.nextMaxSets;
+        for (auto& dps : descriptorPoolSizes) dps.descriptorCount *= maxSets;
+
+        descriptorPool = vsg::DescriptorPool::create(device, maxSets, descriptorPoolSizes);
+        bucket.descriptorPools.push_back(descriptorPool);
+        bucket.nextMaxSets = std::min(maximum_maxSets, std::max(maxSets + 1, static_cast<uint32_t>(static_cast<double>(maxSets) * scale_maxSets)));
+    }
 
     descriptorPools.push_back(descriptorPool);
-    return dsi;
+    return descriptorPool->allocateDescriptorSet(descriptorSetLayout);
 }
 
 void DescriptorPools::report(std::ostream& out, indentation indent) const
@@ -178,18 +205,21 @@ void DescriptorPools::report(std::ostream& out, indentation indent) const
     out << "DescriptorPools::report(..) " << this << " {" << std::endl;
     indent += 4;
 
+    {
+        std::scoped_lock<std::mutex> lock(mutex);
 #if 1
-    out << indent << "descriptorPools " << descriptorPools.size() << std::endl;
+        out << indent << "descriptorPools " << descriptorPools.size() << ", signatureBuckets " << _signatureBuckets.size() << ", reservedPools " << _reservedPools.size() << std::endl;
 #else
-    out << indent << "descriptorPools " << descriptorPools.size() << " {" << std::endl;
-    indent += 4;
-    for (auto& dp : descriptorPools)
-    {
-        dp->report(out, indent);
-    }
-    indent -= 4;
-    out << indent << "}" << std::endl;
+        out << indent << "descriptorPools " << descriptorPools.size() << " {" << std::endl;
+        indent += 4;
+        for (auto& dp : descriptorPools)
+        {
+            dp->report(out, indent);
+        }
+        indent -= 4;
+        out << indent << "}" << std::endl;
 #endif
+    }
 
     uint32_t numSets = 0;
     DescriptorPoolSizes descriptorPoolSizes;
@@ -213,6 +243,8 @@ void DescriptorPools::report(std::ostream& out, indentation indent) const
 
 bool DescriptorPools::available(uint32_t& numSets, DescriptorPoolSizes& availableDescriptorPoolSizes) const
 {
+    std::scoped_lock<std::mutex> lock(mutex);
+
     bool result = false;
     for (auto& dp : descriptorPools)
     {
@@ -223,6 +255,8 @@ bool DescriptorPools::available(uint32_t& numSets, DescriptorPoolSizes& availabl
 
 bool DescriptorPools::used(uint32_t& numSets, DescriptorPoolSizes& descriptorPoolSizes) const
 {
+    std::scoped_lock<std::mutex> lock(mutex);
+
     bool result = false;
     for (auto& dp : descriptorPools)
     {
@@ -233,6 +267,8 @@ bool DescriptorPools::used(uint32_t& numSets, DescriptorPoolSizes& descriptorPoo
 
 bool DescriptorPools::allocated(uint32_t& numSets, DescriptorPoolSizes& descriptorPoolSizes) const
 {
+    std::scoped_lock<std::mutex> lock(mutex);
+
     if (descriptorPools.empty()) return false;
 
     for (const auto& dp : descriptorPools)
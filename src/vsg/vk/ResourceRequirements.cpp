@@ -321,3 +321,39 @@ void CollectResourceRequirements::apply(ref_ptr<ImageInfo> imageInfo)
         }
     }
 }
+
+//////////////////////////////////////////////////////////////////////
+//
+// CollectMemoryUsage
+//
+void CollectMemoryUsage::addData(const Data* data)
+{
+    if (data && _visited.insert(data).second) dataSize += data->dataSize();
+}
+
+void CollectMemoryUsage::apply(ref_ptr<BufferInfo> bufferInfo)
+{
+    CollectResourceRequirements::apply(bufferInfo);
+
+    if (!bufferInfo) return;
+
+    addData(bufferInfo->data);
+
+    // BufferInfo compiled together share a parent BufferInfo holding the device buffer reservation
+    const BufferInfo* reservation = bufferInfo->parent ? bufferInfo->parent.get() : bufferInfo.get();
+    if (reservation->buffer && _visited.insert(reservation).second) deviceMemorySize += reservation->range;
+}
+
+void CollectMemoryUsage::apply(ref_ptr<ImageInfo> imageInfo)
+{
+    CollectResourceRequirements::apply(imageInfo);
+
+    if (!imageInfo || !imageInfo->imageView || !imageInfo->imageView->image) return;
+
+    auto image = imageInfo->imageView->image;
+    if (_visited.insert(image).second)
+    {
+        addData(image->data);
+        deviceMemorySize += image->getMemorySize(deviceID);
+    }
+}